@@ -0,0 +1,93 @@
+// bench/bench_graph_bfs.cpp
+// Building a random directed graph and running a breadth-first search over
+// it: a std::vector of SinglyLinkedLists (one malloc per edge) against
+// AdjacencyList filled edge by edge, bulk-loaded from the edge array, and
+// compacted to CSR form.
+// Usage: bench_graph_bfs [vertices] [edges]   (defaults 1'000'000, 10'000'000)
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "adjacency_list.hpp"
+#include "singly_linked.hpp"
+
+using Clock = std::chrono::steady_clock;
+using Graph = dsa::graph::AdjacencyList<std::uint32_t>;
+
+static double ms_since(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static void report(const char* name, double build, double bfs, std::size_t reached) {
+    std::cout << "  " << name << "build " << build << " ms, BFS " << bfs << " ms (" << reached << " reached)\n";
+}
+
+template <typename Fill>
+static void run_graph(const char* name, std::uint32_t n, Fill fill, bool compact) {
+    auto start = Clock::now();
+    Graph g(n);
+    fill(g);
+    if (compact) {
+        g.compact();
+    }
+    double build = ms_since(start);
+
+    start = Clock::now();
+    std::size_t reached = 0;
+    for (std::uint32_t v : g.bfs(0)) {
+        reached += v != n;   // keeps the loop from being dropped
+    }
+    report(name, build, ms_since(start), reached);
+}
+
+int main(int argc, char* argv[]) {
+    std::uint32_t n = argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1'000'000;
+    std::size_t m = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10'000'000;
+    if (n == 0 || m == 0) {
+        std::cerr << "vertices and edges must be positive\n";
+        return 1;
+    }
+
+    std::vector<Graph::edge_type> edges(m);
+    std::mt19937 rng(17);
+    for (auto& e : edges) {
+        e = {static_cast<std::uint32_t>(rng() % n), static_cast<std::uint32_t>(rng() % n)};
+    }
+    std::cout << n << " vertices, " << m << " edges\n";
+
+    {
+        auto start = Clock::now();
+        std::vector<dsa::list::SinglyLinkedList<std::uint32_t>> lists(n);
+        for (const auto& [from, to] : edges) {
+            lists[from].push_front(to);
+        }
+        double build = ms_since(start);
+
+        start = Clock::now();
+        std::vector<std::uint32_t> queue{0};
+        std::vector<bool> seen(n, false);
+        seen[0] = true;
+        for (std::size_t head = 0; head < queue.size(); ++head) {
+            for (std::uint32_t u : lists[queue[head]]) {
+                if (!seen[u]) {
+                    seen[u] = true;
+                    queue.push_back(u);
+                }
+            }
+        }
+        report("vector<SinglyLinkedList>   ", build, ms_since(start), queue.size());
+    }
+
+    run_graph("AdjacencyList, add_edge    ", n, [&edges](Graph& g) {
+        for (const auto& [from, to] : edges) {
+            g.add_edge(from, to);
+        }
+    }, false);
+    run_graph("AdjacencyList, load_edges  ", n, [&edges](Graph& g) { g.load_edges(edges); }, false);
+    run_graph("AdjacencyList, CSR         ", n, [&edges](Graph& g) { g.load_edges(edges); }, true);
+    return 0;
+}
@@ -0,0 +1,108 @@
+// bench/bench_lru.cpp
+// LruCache against the hand-rolled pattern it replaces (erase the node, push_front
+// a copy, re-point an unordered_map) on Zipfian key traces.
+// Usage: bench_lru [operations] [key space] [zipf exponent]
+//        (defaults 5'000'000, 1'000'000, 0.99)
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "doubly_linked.hpp"
+#include "lru_cache.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// draws keys 0..n-1 with P(k) proportional to 1/(k+1)^s, shuffled so hot keys aren't adjacent
+static std::vector<std::uint64_t> zipf_trace(std::size_t ops, std::size_t n, double s) {
+    std::vector<double> cdf(n);
+    double total = 0;
+    for (std::size_t k = 0; k < n; ++k) {
+        total += 1.0 / std::pow(static_cast<double>(k + 1), s);
+        cdf[k] = total;
+    }
+    std::vector<std::uint64_t> label(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        label[k] = k;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(label.begin(), label.end(), rng);
+    std::uniform_real_distribution<double> u(0.0, total);
+    std::vector<std::uint64_t> trace(ops);
+    for (auto& key : trace) {
+        std::size_t k = std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin();
+        key = label[std::min(k, n - 1)];
+    }
+    return trace;
+}
+
+// the erase + push_front + map pattern
+class HandRolledLru {
+    private:
+        using Entry = std::pair<std::uint64_t, std::uint64_t>;
+        std::size_t cap;
+        dsa::list::DoublyLinkedList<Entry> entries;
+        std::unordered_map<std::uint64_t, dsa::list::DoublyLinkedList<Entry>::iterator> where;
+
+    public:
+        explicit HandRolledLru(std::size_t capacity) : cap{capacity} {}
+
+        bool access(std::uint64_t key) {
+            auto found = where.find(key);
+            if (found != where.end()) {
+                Entry e = *found->second;
+                entries.erase(found->second);
+                entries.push_front(e);
+                found->second = entries.begin();
+                return true;
+            }
+            if (where.size() == cap) {
+                where.erase(entries.back().first);
+                entries.pop_back();
+            }
+            entries.push_front(Entry{key, key});
+            where[key] = entries.begin();
+            return false;
+        }
+};
+
+int main(int argc, char* argv[]) {
+    std::size_t ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+    std::size_t keys = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1'000'000;
+    double s = argc > 3 ? std::atof(argv[3]) : 0.99;
+    auto trace = zipf_trace(ops, keys, s);
+
+    std::cout << ops << " accesses over " << keys << " keys, zipf s=" << s << "\n";
+    for (std::size_t cap : {keys / 100, keys / 10}) {
+        auto start = Clock::now();
+        HandRolledLru naive(cap);
+        std::size_t naive_hits = 0;
+        for (auto key : trace) {
+            naive_hits += naive.access(key);
+        }
+        double naive_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+        start = Clock::now();
+        dsa::cache::LruCache<std::uint64_t, std::uint64_t> cache(cap);
+        for (auto key : trace) {
+            if (cache.get(key) == nullptr) {
+                cache.put(key, key);
+            }
+        }
+        double lru_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+        const auto& st = cache.stats();
+        std::cout << "capacity " << cap << ": hit rate "
+                  << static_cast<double>(st.hits) / static_cast<double>(ops)
+                  << " (hand-rolled " << static_cast<double>(naive_hits) / static_cast<double>(ops) << ")"
+                  << ", evictions " << st.evictions << "\n"
+                  << "  hand-rolled: " << ops / naive_s / 1e6 << " Mops/s\n"
+                  << "  LruCache:    " << ops / lru_s / 1e6 << " Mops/s\n";
+    }
+    return 0;
+}
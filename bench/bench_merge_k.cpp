@@ -0,0 +1,79 @@
+// bench/bench_merge_k.cpp
+// Merging k sorted DoublyLinkedLists: concatenating them and sorting the
+// elements (copied out to a vector and back) against merge_k on one thread
+// and on all hardware threads.
+// Usage: bench_merge_k [lists] [elements per list]   (defaults 256, 20'000)
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "doubly_linked.hpp"
+
+using Clock = std::chrono::steady_clock;
+using List = dsa::list::DoublyLinkedList<std::uint64_t>;
+
+static std::vector<List> make_lists(std::size_t k, std::size_t per_list) {
+    std::mt19937_64 rng(5);
+    std::vector<List> lists(k);
+    for (List& list : lists) {
+        std::uint64_t key = rng() % 1000;
+        for (std::size_t i = 0; i < per_list; ++i) {
+            key += rng() % 1000;   // timestamps, increasing within a log
+            list.push_back(key);
+        }
+    }
+    return lists;
+}
+
+static double ms_since(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t k = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256;
+    std::size_t per_list = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20'000;
+    if (k == 0 || per_list == 0) {
+        std::cerr << "lists and elements must be positive\n";
+        return 1;
+    }
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<List> lists = make_lists(k, per_list);
+    auto start = Clock::now();
+    List all;
+    for (List& list : lists) {
+        all.concatenate(list);
+    }
+    std::vector<std::uint64_t> keys(all.begin(), all.end());
+    std::sort(keys.begin(), keys.end());
+    List sorted;
+    for (std::uint64_t key : keys) {
+        sorted.push_back(key);
+    }
+    double concat_sort = ms_since(start);
+
+    lists = make_lists(k, per_list);
+    start = Clock::now();
+    List merged = merge_k(lists, std::less<>{});
+    double sequential = ms_since(start);
+    bool same = std::equal(merged.begin(), merged.end(), sorted.begin(), sorted.end());
+
+    lists = make_lists(k, per_list);
+    start = Clock::now();
+    List merged_parallel = merge_k(lists, std::less<>{}, threads);
+    double parallel = ms_since(start);
+    same = same && std::equal(merged_parallel.begin(), merged_parallel.end(), sorted.begin(), sorted.end());
+
+    std::cout << k << " lists of " << per_list << " elements\n"
+              << "  concatenate + sort      " << concat_sort << " ms\n"
+              << "  merge_k                 " << sequential << " ms\n"
+              << "  merge_k, threads = " << threads << "  " << parallel << " ms\n"
+              << (same ? "" : "  results differ!\n");
+    return same ? 0 : 1;
+}
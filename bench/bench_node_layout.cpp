@@ -0,0 +1,115 @@
+// bench/bench_node_layout.cpp
+// Traversal cost of SinglyLinkedList under each node layout for elements of
+// 8 to 512 bytes: "walk" follows the links only, "scan" also reads a key
+// from every element. Each list is timed twice: as restored by load(), with
+// its nodes in one slab in list order, and after random inserts, with list
+// order and allocation order unrelated so the prefetcher can't hide misses.
+// Usage: bench_node_layout [elements] [passes]   (defaults 1'000'000, 5)
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "singly_linked.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+template <std::size_t Bytes>
+struct Element {
+    std::uint64_t key;
+    char pad[Bytes - sizeof(std::uint64_t)]{};
+};
+
+template <>
+struct Element<8> {
+    std::uint64_t key;
+};
+
+template <typename List>
+static void time_list(const char* name, const List& list, std::size_t n, int passes) {
+    using Elem = std::remove_cvref_t<decltype(list.front())>;
+
+    std::size_t steps = 0;
+    auto start = Clock::now();
+    for (int p = 0; p < passes; ++p) {
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            steps++;
+        }
+    }
+    double walk = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / double(n * passes);
+
+    std::uint64_t sum = 0;
+    start = Clock::now();
+    for (int p = 0; p < passes; ++p) {
+        for (const Elem& e : list) {
+            sum += e.key;
+        }
+    }
+    double scan = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / double(n * passes);
+
+    std::cout << "  " << name << ": walk " << walk << " ns/node, scan " << scan << " ns/node"
+              << (sum + steps == 42 ? "!" : "") << "\n";   // keeps the work observable
+}
+
+template <typename List>
+static void run(const char* name, std::size_t n, int passes) {
+    using Elem = std::remove_cvref_t<decltype(std::declval<List&>().front())>;
+
+    // restored from a checkpoint: load() builds all nodes in one slab, in list order
+    {
+        List source;
+        for (std::size_t i = 0; i < n; ++i) {
+            source.push_back(Elem{i});
+        }
+        std::stringstream checkpoint;
+        source.save(checkpoint);
+        source.clear();
+        List loaded;
+        loaded.load(checkpoint);
+        time_list((std::string(name) + " loaded  ").c_str(), loaded, n, passes);
+    }
+
+    // each element goes in after a random earlier one, so list order and
+    // allocation order disagree
+    List shuffled;
+    shuffled.push_back(Elem{0});
+    std::vector<typename List::iterator> placed{shuffled.begin()};
+    placed.reserve(n);
+    std::mt19937_64 rng(11);
+    for (std::size_t i = 1; i < n; ++i) {
+        placed.push_back(shuffled.insert_after(placed[rng() % placed.size()], Elem{i}));
+    }
+    time_list((std::string(name) + " shuffled").c_str(), shuffled, n, passes);
+}
+
+template <std::size_t Bytes>
+static void run_size(std::size_t n, int passes) {
+    using namespace dsa::list;
+    std::cout << Bytes << "-byte elements\n";
+    run<SinglyLinkedList<Element<Bytes>, std::size_t, layout::inline_payload>>("inline       ", n, passes);
+    run<SinglyLinkedList<Element<Bytes>, std::size_t, layout::cache_aligned>>("cache_aligned", n, passes);
+    run<SinglyLinkedList<Element<Bytes>, std::size_t, layout::out_of_line>>("out_of_line  ", n, passes);
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    int passes = argc > 2 ? std::atoi(argv[2]) : 5;
+    if (n == 0 || passes <= 0) {
+        std::cerr << "elements and passes must be positive\n";
+        return 1;
+    }
+
+    std::cout << n << " elements, " << passes << " passes\n";
+    run_size<8>(n, passes);
+    run_size<64>(n, passes);
+    run_size<256>(n, passes);
+    run_size<512>(n, passes);
+    return 0;
+}
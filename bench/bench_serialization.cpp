@@ -0,0 +1,77 @@
+// bench/bench_serialization.cpp
+// Checkpoint and restart times for a SinglyLinkedList<std::int64_t>:
+// element-at-a-time writes and push_back reloads against save()/load().
+// Usage: bench_serialization [elements]   (default 10'000'000)
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "singly_linked.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc > 1 ? std::atoll(argv[1]) : 10'000'000;
+    const std::string path = "bench_serialization.bin";
+
+    dsa::list::SinglyLinkedList<std::int64_t> list;
+    for (long long i = 0; i < n; ++i) {
+        list.push_back(i);
+    }
+
+    auto start = Clock::now();
+    {
+        std::ofstream out(path, std::ios::binary);
+        std::int64_t count = list.size();
+        out.write(reinterpret_cast<const char*>(&count), sizeof count);
+        for (std::int64_t x : list) {
+            out.write(reinterpret_cast<const char*>(&x), sizeof x);
+        }
+    }
+    double naive_save = seconds_since(start);
+
+    start = Clock::now();
+    {
+        std::ifstream in(path, std::ios::binary);
+        dsa::list::SinglyLinkedList<std::int64_t> restored;
+        std::int64_t count = 0;
+        in.read(reinterpret_cast<char*>(&count), sizeof count);
+        for (std::int64_t i = 0; i < count; ++i) {
+            std::int64_t x;
+            in.read(reinterpret_cast<char*>(&x), sizeof x);
+            restored.push_back(x);
+        }
+    }
+    double naive_load = seconds_since(start);
+
+    start = Clock::now();
+    {
+        std::ofstream out(path, std::ios::binary);
+        list.save(out);
+    }
+    double bulk_save = seconds_since(start);
+
+    start = Clock::now();
+    {
+        std::ifstream in(path, std::ios::binary);
+        dsa::list::SinglyLinkedList<std::int64_t> restored;
+        restored.load(in);
+    }
+    double bulk_load = seconds_since(start);
+
+    std::remove(path.c_str());
+
+    std::cout << n << " elements\n";
+    std::cout << "per-element write:  " << naive_save << " s\n";
+    std::cout << "per-element reload: " << naive_load << " s (includes freeing the list)\n";
+    std::cout << "save():             " << bulk_save << " s\n";
+    std::cout << "load():             " << bulk_load << " s (includes freeing the list)\n";
+    return 0;
+}
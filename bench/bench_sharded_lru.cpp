@@ -0,0 +1,97 @@
+// bench/bench_sharded_lru.cpp
+// Throughput of a single-lock LruCache against ShardedLruCache (eager and lazy
+// promotion) from 1 to 64 threads on a shared Zipfian key trace.
+// Usage: bench_sharded_lru [operations per thread] [key space] [shards]
+//        (defaults 1'000'000, 1'000'000, 64)
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "lru_cache.hpp"
+#include "sharded_lru_cache.hpp"
+
+using Clock = std::chrono::steady_clock;
+using Key = std::uint64_t;
+
+static std::vector<Key> zipf_trace(std::size_t ops, std::size_t n, double s) {
+    std::vector<double> cdf(n);
+    double total = 0;
+    for (std::size_t k = 0; k < n; ++k) {
+        total += 1.0 / std::pow(static_cast<double>(k + 1), s);
+        cdf[k] = total;
+    }
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> u(0.0, total);
+    std::vector<Key> trace(ops);
+    for (auto& key : trace) {
+        key = std::min<std::size_t>(std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin(), n - 1);
+    }
+    return trace;
+}
+
+// runs access(key) over the trace from `threads` threads, each from its own offset
+template <typename Access>
+static double run(unsigned threads, const std::vector<Key>& trace, std::size_t ops, Access access) {
+    std::vector<std::thread> workers;
+    auto start = Clock::now();
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            std::size_t offset = (trace.size() / threads) * t;
+            for (std::size_t i = 0; i < ops; ++i) {
+                access(trace[(offset + i) % trace.size()]);
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(ops) * threads / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    std::size_t keys = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1'000'000;
+    std::size_t shard_count = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 64;
+    std::size_t capacity = keys / 10;
+    auto trace = zipf_trace(std::max<std::size_t>(ops, 1'000'000), keys, 0.99);
+
+    std::cout << "Mops/s, capacity " << capacity << ", " << shard_count << " shards, "
+              << std::thread::hardware_concurrency() << " hardware threads\n";
+    std::cout << "threads  single-lock  sharded  sharded-lazy\n";
+    for (unsigned threads = 1; threads <= 64; threads *= 2) {
+        dsa::cache::LruCache<Key, Key> single(capacity);
+        std::mutex single_lock;
+        double one = run(threads, trace, ops, [&](Key key) {
+            std::lock_guard guard(single_lock);
+            if (single.get(key) == nullptr) {
+                single.put(key, key);
+            }
+        });
+
+        using Sharded = dsa::cache::ShardedLruCache<Key, Key>;
+        Sharded eager(capacity, shard_count);
+        double sharded = run(threads, trace, ops, [&](Key key) {
+            if (!eager.get(key)) {
+                eager.put(key, key);
+            }
+        });
+
+        Sharded lazy(capacity, shard_count, Sharded::Promotion::lazy);
+        double lazy_rate = run(threads, trace, ops, [&](Key key) {
+            if (!lazy.get(key)) {
+                lazy.put(key, key);
+            }
+        });
+
+        std::cout << threads << "\t " << one << "\t      " << sharded << "\t" << lazy_rate << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+// bench/bench_timer_wheel.cpp
+// TimerWheel against a std::priority_queue timer with lazy cancellation:
+// schedule N timers with random delays, cancel half, then run the clock
+// until everything has expired.
+// Usage: bench_timer_wheel [timers] [max delay]   (defaults 1'000'000, 100'000)
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "timer_wheel.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// min-heap on expiry; cancel flips a flag that expiry checks
+class HeapTimer {
+    private:
+        struct Item {
+            std::uint64_t expiry;
+            std::uint32_t id;
+            bool operator>(const Item& other) const { return expiry > other.expiry; }
+        };
+        std::priority_queue<Item, std::vector<Item>, std::greater<>> heap;
+        std::vector<bool> cancelled;
+        std::uint64_t now{0};
+
+    public:
+        std::uint32_t schedule(std::uint64_t delay) {
+            auto id = static_cast<std::uint32_t>(cancelled.size());
+            cancelled.push_back(false);
+            heap.push(Item{now + delay, id});
+            return id;
+        }
+
+        void cancel(std::uint32_t id) {
+            cancelled[id] = true;
+        }
+
+        std::size_t advance(std::uint64_t ticks) {
+            std::size_t fired = 0;
+            now += ticks;
+            while (!heap.empty() && heap.top().expiry <= now) {
+                fired += !cancelled[heap.top().id];
+                heap.pop();
+            }
+            return fired;
+        }
+};
+
+int main(int argc, char* argv[]) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    std::uint64_t max_delay = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100'000;
+
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<std::uint64_t> delay(1, max_delay);
+    std::vector<std::uint64_t> delays(n);
+    for (auto& d : delays) {
+        d = delay(rng);
+    }
+
+    std::cout << n << " timers, delays 1.." << max_delay << ", half cancelled\n";
+
+    {
+        dsa::timer::TimerWheel<std::uint32_t> wheel;
+        std::vector<dsa::timer::TimerWheel<std::uint32_t>::TimerId> ids(n);
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < n; ++i) {
+            ids[i] = wheel.schedule(delays[i], static_cast<std::uint32_t>(i));
+        }
+        double schedule_s = seconds_since(start);
+        start = Clock::now();
+        for (std::size_t i = 0; i < n; i += 2) {
+            wheel.cancel(ids[i]);
+        }
+        double cancel_s = seconds_since(start);
+        start = Clock::now();
+        std::size_t fired = wheel.advance(max_delay, [](auto, std::uint32_t) {});
+        double expire_s = seconds_since(start);
+        std::cout << "TimerWheel:     schedule " << n / schedule_s / 1e6 << " M/s, cancel "
+                  << n / 2 / cancel_s / 1e6 << " M/s, expire " << fired / expire_s / 1e6
+                  << " M/s (" << fired << " fired)\n";
+    }
+
+    {
+        HeapTimer heap;
+        std::vector<std::uint32_t> ids(n);
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < n; ++i) {
+            ids[i] = heap.schedule(delays[i]);
+        }
+        double schedule_s = seconds_since(start);
+        start = Clock::now();
+        for (std::size_t i = 0; i < n; i += 2) {
+            heap.cancel(ids[i]);
+        }
+        double cancel_s = seconds_since(start);
+        start = Clock::now();
+        std::size_t fired = 0;
+        for (std::uint64_t t = 0; t < max_delay; ++t) {
+            fired += heap.advance(1);
+        }
+        double expire_s = seconds_since(start);
+        std::cout << "priority_queue: schedule " << n / schedule_s / 1e6 << " M/s, cancel "
+                  << n / 2 / cancel_s / 1e6 << " M/s, expire " << fired / expire_s / 1e6
+                  << " M/s (" << fired << " fired)\n";
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+// bench/bench_xor_list.cpp
+// Memory footprint and traversal speed of XorLinkedList against
+// DoublyLinkedList, for 8-byte elements: heap bytes per element, and
+// forward and backward sums over the whole list.
+// Usage: bench_xor_list [elements] [passes]   (defaults 10'000'000, 10)
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "doubly_linked.hpp"
+#include "xor_linked.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// heap bytes requested through operator new, to measure the lists' footprint
+static std::size_t heap_bytes = 0;
+
+void* operator new(std::size_t n) {
+    heap_bytes += n;
+    if (void* p = std::malloc(n)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t n, std::align_val_t al) {
+    heap_bytes += n;
+    std::size_t a = static_cast<std::size_t>(al);
+    if (void* p = std::aligned_alloc(a, (n + a - 1) / a * a)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+template <typename List>
+static void run(const char* name, long long n, int passes) {
+    std::size_t before = heap_bytes;
+    List list;
+    for (long long i = 0; i < n; ++i) {
+        list.push_back(static_cast<std::uint64_t>(i));
+    }
+    double per_elem = static_cast<double>(heap_bytes - before) / static_cast<double>(n);
+
+    std::uint64_t sum = 0;
+    auto start = Clock::now();
+    for (int p = 0; p < passes; ++p) {
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            sum += *it;
+        }
+    }
+    double forward = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double(n) * passes);
+
+    start = Clock::now();
+    for (int p = 0; p < passes; ++p) {
+        for (auto it = list.end(); it != list.begin();) {
+            sum += *--it;
+        }
+    }
+    double backward = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double(n) * passes);
+
+    std::cout << name << ": " << per_elem << " heap bytes/element, forward "
+              << forward << " ns/element, backward " << backward << " ns/element"
+              << (sum == 42 ? "!" : "") << "\n";   // keeps the sums observable
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc > 1 ? std::atoll(argv[1]) : 10'000'000;
+    int passes = argc > 2 ? std::atoi(argv[2]) : 10;
+    if (n <= 0 || passes <= 0) {
+        std::cerr << "elements and passes must be positive\n";
+        return 1;
+    }
+
+    std::cout << n << " std::uint64_t elements, " << passes << " passes\n";
+    run<dsa::list::DoublyLinkedList<std::uint64_t>>("DoublyLinkedList", n, passes);
+    run<dsa::list::XorLinkedList<std::uint64_t>>("XorLinkedList   ", n, passes);
+    return 0;
+}
@@ -0,0 +1,447 @@
+#pragma once
+
+#include <algorithm>   // provides std::fill
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>      // provides std::construct_at
+#include <span>
+#include <stdexcept>
+#include <utility>     // provides std::pair, std::swap
+#include <vector>
+
+#include "node_pool.hpp"
+
+namespace dsa::graph {
+
+// Directed graph stored as one singly linked edge list per vertex.
+// All edge nodes come from one arena (a NodePool used only through bulk()),
+// so adding an edge never calls malloc on its own, and the whole graph is
+// freed slab by slab rather than edge by edge. Edges can't be removed.
+// add_edge() puts the new edge first in its vertex's list; load_edges()
+// keeps the order of its array and lays every vertex's new edges out next
+// to each other.
+// compact() converts the graph to CSR form (an offset per vertex into one
+// array of targets) for read-heavy phases; adding a vertex or edge converts
+// it back. Neighbour order is the same in both forms.
+template <std::unsigned_integral Vertex = std::uint32_t>
+class AdjacencyList {
+    public:
+        using vertex_type = Vertex;
+        using edge_type = std::pair<Vertex, Vertex>;   // (from, to)
+
+    private:
+        struct Edge {
+            Edge* next;
+            Vertex to;
+        };
+
+        static constexpr std::size_t min_chunk = 1024;   // edges in the first arena slab
+
+        std::vector<Edge*> heads;            // per vertex, nullptr when compacted
+        dsa::list::NodePool<Edge> arena;
+        Edge* spare{nullptr};                // unused slots of the newest slab
+        std::size_t spare_count{0};
+        std::size_t chunk{min_chunk};        // size of the next slab, doubled each time
+        std::size_t edges{0};
+
+        // CSR form: targets[offsets[v]] to targets[offsets[v + 1] - 1] are v's
+        // neighbours. Empty unless compacted.
+        std::vector<std::size_t> offsets;
+        std::vector<Vertex> targets;
+        bool compacted{false};
+
+        void check(Vertex v) const {
+            if (v >= vertex_count()) {
+                throw std::out_of_range("AdjacencyList: vertex out of range");
+            }
+        }
+
+        Edge* new_edge(Vertex to, Edge* next) {
+            if (spare_count == 0) {
+                spare = arena.bulk(chunk);
+                spare_count = chunk;
+                chunk *= 2;
+            }
+            spare_count--;
+            return std::construct_at(spare++, Edge{next, to});
+        }
+
+        // back from CSR to lists, in one slab
+        void expand() {
+            if (!compacted) {
+                return;
+            }
+            Edge* slots = arena.bulk(targets.size());
+            for (std::size_t v = 0; v < heads.size(); ++v) {
+                Edge* next = nullptr;
+                for (std::size_t i = offsets[v + 1]; i > offsets[v]; --i) {
+                    next = std::construct_at(slots + i - 1, Edge{next, targets[i - 1]});
+                }
+                heads[v] = next;
+            }
+            offsets = {};
+            targets = {};
+            compacted = false;
+        }
+
+    public:
+        // Forward iterator over a vertex's neighbours, in either form.
+        class neighbor_iterator {
+            friend class AdjacencyList;
+
+            private:
+                const Edge* edge;      // list form
+                const Vertex* pos;     // CSR form, used when edge is nullptr
+
+                neighbor_iterator(const Edge* e, const Vertex* p)
+                : edge(e), pos(p) {}
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Vertex;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Vertex*;
+                using reference = const Vertex&;
+
+                neighbor_iterator()
+                : edge(nullptr), pos(nullptr) {}
+
+                const Vertex& operator*() const {
+                    return edge != nullptr ? edge->to : *pos;
+                }
+                neighbor_iterator& operator++() {
+                    if (edge != nullptr) {
+                        edge = edge->next;
+                    } else {
+                        ++pos;
+                    }
+                    return *this;
+                }
+                neighbor_iterator operator++(int) {
+                    neighbor_iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                bool operator==(const neighbor_iterator& other) const {
+                    return edge == other.edge && pos == other.pos;
+                }
+                bool operator!=(const neighbor_iterator& other) const {
+                    return !(*this == other);
+                }
+        };
+
+        class neighbor_range {
+            private:
+                neighbor_iterator first;
+                neighbor_iterator last;
+
+            public:
+                neighbor_range(neighbor_iterator f, neighbor_iterator l)
+                : first(f), last(l) {}
+
+                neighbor_iterator begin() const {
+                    return first;
+                }
+                neighbor_iterator end() const {
+                    return last;
+                }
+        };
+
+        // Vertices reachable from a source, each once, in breadth-first
+        // order. Vertices are discovered lazily as the iteration advances;
+        // the graph must not change meanwhile.
+        class breadth_first {
+            private:
+                const AdjacencyList* graph;
+                std::vector<Vertex> queue;   // discovered vertices; [head, end) still to visit
+                std::size_t head{0};
+                std::vector<bool> seen;
+
+            public:
+                class iterator {
+                    private:
+                        breadth_first* walk;
+
+                    public:
+                        using iterator_category = std::input_iterator_tag;
+                        using value_type = Vertex;
+                        using difference_type = std::ptrdiff_t;
+
+                        explicit iterator(breadth_first* w = nullptr)
+                        : walk(w) {}
+
+                        Vertex operator*() const {
+                            return walk->queue[walk->head];
+                        }
+                        iterator& operator++() {
+                            walk->advance();
+                            return *this;
+                        }
+                        void operator++(int) {
+                            walk->advance();
+                        }
+                        bool operator==(std::default_sentinel_t) const {
+                            return walk->head == walk->queue.size();
+                        }
+                };
+
+                breadth_first(const AdjacencyList& g, Vertex source)
+                : graph(&g), seen(g.vertex_count(), false) {
+                    g.check(source);
+                    queue.reserve(g.vertex_count());
+                    queue.push_back(source);
+                    seen[source] = true;
+                }
+
+                // queues the current vertex's unseen neighbours and moves on
+                void advance() {
+                    for (Vertex u : graph->adjacent(queue[head])) {
+                        if (!seen[u]) {
+                            seen[u] = true;
+                            queue.push_back(u);
+                        }
+                    }
+                    ++head;
+                }
+
+                iterator begin() {
+                    return iterator(this);
+                }
+                std::default_sentinel_t end() const {
+                    return std::default_sentinel;
+                }
+        };
+
+        // Vertices reachable from a source, each once, in depth-first
+        // preorder, following neighbours in their stored order. Lazy, like
+        // breadth_first.
+        class depth_first {
+            private:
+                const AdjacencyList* graph;
+                // the path from the source; each entry's iterator is its next neighbour to try
+                std::vector<std::pair<Vertex, neighbor_iterator>> stack;
+                std::vector<bool> seen;
+
+            public:
+                class iterator {
+                    private:
+                        depth_first* walk;
+
+                    public:
+                        using iterator_category = std::input_iterator_tag;
+                        using value_type = Vertex;
+                        using difference_type = std::ptrdiff_t;
+
+                        explicit iterator(depth_first* w = nullptr)
+                        : walk(w) {}
+
+                        Vertex operator*() const {
+                            return walk->stack.back().first;
+                        }
+                        iterator& operator++() {
+                            walk->advance();
+                            return *this;
+                        }
+                        void operator++(int) {
+                            walk->advance();
+                        }
+                        bool operator==(std::default_sentinel_t) const {
+                            return walk->stack.empty();
+                        }
+                };
+
+                depth_first(const AdjacencyList& g, Vertex source)
+                : graph(&g), seen(g.vertex_count(), false) {
+                    g.check(source);
+                    stack.push_back({source, g.adjacent(source).begin()});
+                    seen[source] = true;
+                }
+
+                // descends to the next unseen vertex, backtracking as needed
+                void advance() {
+                    while (!stack.empty()) {
+                        auto& [v, next] = stack.back();
+                        neighbor_iterator last = graph->adjacent(v).end();
+                        while (next != last && seen[*next]) {
+                            ++next;
+                        }
+                        if (next != last) {
+                            Vertex u = *next++;
+                            seen[u] = true;
+                            stack.push_back({u, graph->adjacent(u).begin()});
+                            return;
+                        }
+                        stack.pop_back();
+                    }
+                }
+
+                iterator begin() {
+                    return iterator(this);
+                }
+                std::default_sentinel_t end() const {
+                    return std::default_sentinel;
+                }
+        };
+
+    private:
+        // neighbors() without the range check, for the traversals
+        neighbor_range adjacent(Vertex v) const {
+            if (compacted) {
+                return neighbor_range(neighbor_iterator(nullptr, targets.data() + offsets[v]),
+                                      neighbor_iterator(nullptr, targets.data() + offsets[v + 1]));
+            }
+            return neighbor_range(neighbor_iterator(heads[v], nullptr), neighbor_iterator());
+        }
+
+    public:
+        explicit AdjacencyList(Vertex vertices = 0)
+        : heads(vertices, nullptr) {}
+
+        // The edges point into the arena, which can't be shared
+        AdjacencyList(const AdjacencyList&) = delete;
+        AdjacencyList& operator=(const AdjacencyList&) = delete;
+
+        // a moved-from graph is empty
+        AdjacencyList(AdjacencyList&& other) noexcept
+        : AdjacencyList() {
+            swap(*this, other);
+        }
+
+        AdjacencyList& operator=(AdjacencyList&& other) noexcept {
+            if (this != &other) {
+                AdjacencyList taken(std::move(other));
+                swap(*this, taken);
+            }
+            return *this;
+        }
+
+        Vertex vertex_count() const {
+            return static_cast<Vertex>(heads.size());
+        }
+
+        std::size_t edge_count() const {
+            return edges;
+        }
+
+        bool is_compacted() const {
+            return compacted;
+        }
+
+        // adds an isolated vertex and returns its number
+        Vertex add_vertex() {
+            expand();
+            heads.push_back(nullptr);
+            return static_cast<Vertex>(heads.size() - 1);
+        }
+
+        // Adds the edge from -> to in O(1) (plus O(V + E) if compacted);
+        // throws std::out_of_range for an unknown vertex.
+        void add_edge(Vertex from, Vertex to) {
+            check(from);
+            check(to);
+            expand();
+            heads[from] = new_edge(to, heads[from]);
+            edges++;
+        }
+
+        // Adds all edges from one slab, grouped by source vertex with each
+        // vertex's edges in array order, ahead of its older edges. O(V + E).
+        // Throws std::out_of_range, before adding anything, if an edge names
+        // an unknown vertex.
+        void load_edges(std::span<const edge_type> list) {
+            for (const edge_type& e : list) {
+                check(e.first);
+                check(e.second);
+            }
+            if (list.empty()) {
+                return;
+            }
+            expand();
+            // counting sort by source: start[v] is v's first slot in the slab
+            std::vector<std::size_t> start(heads.size() + 1, 0);
+            for (const edge_type& e : list) {
+                start[e.first + 1]++;
+            }
+            for (std::size_t v = 1; v < start.size(); ++v) {
+                start[v] += start[v - 1];
+            }
+            Edge* slots = arena.bulk(list.size());
+            std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+            for (const edge_type& e : list) {
+                std::size_t i = fill[e.first]++;
+                std::construct_at(slots + i, Edge{slots + i + 1, e.second});
+            }
+            for (std::size_t v = 0; v < heads.size(); ++v) {
+                if (start[v] < start[v + 1]) {
+                    slots[start[v + 1] - 1].next = heads[v];
+                    heads[v] = slots + start[v];
+                }
+            }
+            edges += list.size();
+        }
+
+        neighbor_range neighbors(Vertex v) const {
+            check(v);
+            return adjacent(v);
+        }
+
+        std::size_t out_degree(Vertex v) const {
+            check(v);
+            if (compacted) {
+                return offsets[v + 1] - offsets[v];
+            }
+            std::size_t n = 0;
+            for (const Edge* e = heads[v]; e != nullptr; e = e->next) {
+                n++;
+            }
+            return n;
+        }
+
+        breadth_first bfs(Vertex source) const {
+            return breadth_first(*this, source);
+        }
+
+        depth_first dfs(Vertex source) const {
+            return depth_first(*this, source);
+        }
+
+        // Converts to CSR form and frees the arena: neighbours then sit in one
+        // array, in the same order. O(V + E).
+        void compact() {
+            if (compacted) {
+                return;
+            }
+            offsets.assign(heads.size() + 1, 0);
+            targets.clear();
+            targets.reserve(edges);
+            for (std::size_t v = 0; v < heads.size(); ++v) {
+                for (const Edge* e = heads[v]; e != nullptr; e = e->next) {
+                    targets.push_back(e->to);
+                }
+                offsets[v + 1] = targets.size();
+            }
+            std::fill(heads.begin(), heads.end(), nullptr);
+            arena = dsa::list::NodePool<Edge>{};
+            spare = nullptr;
+            spare_count = 0;
+            chunk = min_chunk;
+            compacted = true;
+        }
+
+        friend void swap(AdjacencyList& a, AdjacencyList& b) {
+            using std::swap;
+            swap(a.heads, b.heads);
+            swap(a.arena, b.arena);
+            swap(a.spare, b.spare);
+            swap(a.spare_count, b.spare_count);
+            swap(a.chunk, b.chunk);
+            swap(a.edges, b.edges);
+            swap(a.offsets, b.offsets);
+            swap(a.targets, b.targets);
+            swap(a.compacted, b.compacted);
+        }
+};
+
+}  // namespace dsa::graph
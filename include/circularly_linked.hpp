@@ -1,30 +1,59 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>      // provides std::construct_at
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>     // provides std::swap
 
+#include "list_io.hpp"
+#include "node_layout.hpp"
+#include "node_pool.hpp"
+
 namespace dsa::list {
 
 /// circularly linked list
-template <typename T>
+// SizeType counts the elements; std::uint32_t saves space for lists that stay small.
+// Layout places the element in the node (see node_layout.hpp).
+template <typename T, std::unsigned_integral SizeType = std::size_t, typename Layout = layout::inline_payload>
 class CircularlyLinkedList {
+    public:
+        using size_type = SizeType;
+
     private:
-        class Node {
+        class alignas(Layout::node_alignment) alignas(T) Node {
             public:
                 Node* next;    
-                T elem;
+                typename Layout::template payload<T> data;
                 Node(const T& element, Node* nxt = nullptr) 
-                : elem{element}, next{nxt} {}
+                : next{nxt}, data{element} {}
+
+                T& elem() { return data.get(); }
+                const T& elem() const { return data.get(); }
         };
-        int sz{0};
+        SizeType sz{0};
         Node* tail{nullptr};
+        NodePool<Node> pool;  // where nodes are allocated and freed
 
     public:
         // ToDo: Constructs an empty list
         CircularlyLinkedList() : sz{0}, tail{nullptr} {}
 
-        int size() const {
+        size_type size() const {
             return sz;
         }
+
+        // largest size the size type can count; growing past it throws
+        // std::length_error
+        static constexpr size_type max_size() {
+            return std::numeric_limits<size_type>::max();
+        }
     
         bool empty() const {
             return sz == 0;
@@ -34,48 +63,50 @@ class CircularlyLinkedList {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return tail->next->elem;
+            return tail->next->elem();
         }
 
         const T& front() const {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return tail->next->elem;
+            return tail->next->elem();
         }
 
         T& back() {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return tail->elem;
+            return tail->elem();
         }
 
         const T& back() const {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return tail->elem;
+            return tail->elem();
         }
 
         void push_front(const T& elem) {
+            check_room();
             if (sz == 0) {
-                tail = new Node(elem);
+                tail = pool.create(elem);
                 tail->next = tail;
             } else {
-                Node* new_node = new Node(elem, tail->next);
+                Node* new_node = pool.create(elem, tail->next);
                 tail->next = new_node;
             }
             sz++;
         }
 
         void push_back(const T& elem) {
+            check_room();
             if(empty()) {
-                tail = new Node(elem);
+                tail = pool.create(elem);
                 tail->next = tail;
             }
             else {
-                Node* new_node = new Node(elem, tail->next);
+                Node* new_node = pool.create(elem, tail->next);
                 tail->next = new_node;
                 tail=new_node;
             }
@@ -94,7 +125,7 @@ class CircularlyLinkedList {
             else{
                 tail->next = prev_head->next;
             }
-            delete prev_head;
+            pool.destroy(prev_head);
             sz--;
         }
 
@@ -103,7 +134,23 @@ class CircularlyLinkedList {
             if (tail != nullptr)
                 tail = tail->next;
         }
-    
+
+        // Rotates k places forward (k < 0 rotates backward) in one walk of
+        // at most size() - 1 steps
+        void rotate(std::ptrdiff_t k) {
+            if (sz <= 1) {
+                return;
+            }
+            std::ptrdiff_t n = static_cast<std::ptrdiff_t>(sz);
+            std::ptrdiff_t steps = k % n;
+            if (steps < 0) {
+                steps += n;    // back by |k| is forward by sz - |k|
+            }
+            while (steps-- > 0) {
+                tail = tail->next;
+            }
+        }
+
         // Splits the current even-sized circular list into two equal-sized circular lists A and B
         // After splitting, A and B become the two halves (preserving original order), and the original list becomes empty. 
         //If the size is odd, throw std::logic_error
@@ -115,17 +162,21 @@ class CircularlyLinkedList {
                 throw std::logic_error("Cant split list evenly");
             }
 
-            int halfsize = sz/2;
+            SizeType halfsize = sz/2;
             Node* head_A = this->tail->next;
             
             Node* tail_A = head_A;
-            for (int i = 0; i < halfsize - 1; ++i) {
+            for (SizeType i = 0; i + 1 < halfsize; ++i) {
                 tail_A = tail_A->next;
             }
 
             Node* head_B = tail_A->next;
             Node* tail_B = this->tail;
 
+            // A and B now hold nodes that may live in our slabs
+            A.pool.adopt(pool);
+            B.pool.adopt(pool);
+
             //circular
             tail_A->next = head_A;
             A.tail = tail_A;
@@ -139,15 +190,325 @@ class CircularlyLinkedList {
             this->sz = 0;
         }
 
+        // Iterators make exactly one lap, from front() to back().
+        // Each one holds the node *before* its element (so the ring can be
+        // changed at its position in O(1)) and how many steps it is from begin().
+        class const_iterator;
+
+        class iterator {
+            // needed for CircularlyLinkedList's insert_after and erase_after
+            friend class CircularlyLinkedList;
+            friend class const_iterator;
+
+            private:
+                Node* prev_ptr;   // node before the current one
+                SizeType pos;     // steps taken since begin()
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                iterator(Node* prev = nullptr, SizeType p = 0)
+                : prev_ptr(prev), pos(p) {}
+
+                T& operator*() const {
+                    return prev_ptr->next->elem();
+                }
+                T* operator->() const {
+                    return &(prev_ptr->next->elem());
+                }
+                iterator& operator++() {
+                    prev_ptr = prev_ptr->next;
+                    ++pos;
+                    return *this;
+                }
+                iterator operator++(int) {
+                    iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                bool operator==(iterator rhs) const {
+                    return pos == rhs.pos && prev_ptr == rhs.prev_ptr;
+                }
+                bool operator!=(iterator rhs) const {
+                    return !(*this == rhs);
+                }
+        };
+
+        class const_iterator {
+            private:
+                const Node* prev_ptr;
+                SizeType pos;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                const_iterator(const Node* prev = nullptr, SizeType p = 0)
+                : prev_ptr(prev), pos(p) {}
+                const_iterator(iterator it)
+                : prev_ptr(it.prev_ptr), pos(it.pos) {}
+
+                const T& operator*() const {
+                    return prev_ptr->next->elem();
+                }
+                const T* operator->() const {
+                    return &(prev_ptr->next->elem());
+                }
+                const_iterator& operator++() {
+                    prev_ptr = prev_ptr->next;
+                    ++pos;
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                bool operator==(const_iterator rhs) const {
+                    return pos == rhs.pos && prev_ptr == rhs.prev_ptr;
+                }
+                bool operator!=(const_iterator rhs) const {
+                    return !(*this == rhs);
+                }
+        };
+
+        // A cursor keeps going around the ring: there is no end, ++ from back()
+        // returns to front(). Reading through it doesn't change the list.
+        class cursor {
+            friend class CircularlyLinkedList;
+
+            private:
+                Node* prev_ptr;
+
+            public:
+                cursor(Node* prev = nullptr)
+                : prev_ptr(prev) {}
+
+                T& operator*() const {
+                    return prev_ptr->next->elem();
+                }
+                T* operator->() const {
+                    return &(prev_ptr->next->elem());
+                }
+                cursor& operator++() {
+                    prev_ptr = prev_ptr->next;
+                    return *this;
+                }
+                cursor operator++(int) {
+                    cursor old = *this;
+                    ++(*this);
+                    return old;
+                }
+                bool operator==(cursor rhs) const {
+                    return prev_ptr == rhs.prev_ptr;
+                }
+                bool operator!=(cursor rhs) const {
+                    return prev_ptr != rhs.prev_ptr;
+                }
+        };
+
+        iterator begin() {
+            return iterator(tail, 0);
+        }
+
+        const_iterator begin() const {
+            return const_iterator(tail, 0);
+        }
+
+        iterator end() {
+            return iterator(tail, sz);
+        }
+
+        const_iterator end() const {
+            return const_iterator(tail, sz);
+        }
+
+        const_iterator cbegin() const {
+            return begin();
+        }
+
+        const_iterator cend() const {
+            return end();
+        }
+
+        // cursor on front(); throws if the list is empty
+        cursor ring_cursor() {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return cursor(tail);
+        }
+
+        // Makes the element at it the front in O(1); order around the ring is kept.
+        // Iterators taken before this no longer line up with begin()/end().
+        void rotate_to(iterator it) {
+            if (empty() || it == end()) {
+                throw std::runtime_error("Can't rotate to end iterator");
+            }
+            tail = it.prev_ptr;
+        }
+
+        // Inserts elem after the element at it (which may be back()) and
+        // returns an iterator to the new element
+        iterator insert_after(iterator it, const T& elem) {
+            if (empty() || it == end()) {
+                throw std::runtime_error("Can't insert after end iterator");
+            }
+            check_room();
+            Node* current_node = it.prev_ptr->next;
+            Node* new_node = pool.create(elem, current_node->next);
+            current_node->next = new_node;
+            if (current_node == tail) {
+                tail = new_node;
+            }
+            sz++;
+            return iterator(current_node, it.pos + 1);
+        }
+
+        // Erases the element after the one at it; after back() that is front().
+        // Returns an iterator to the element that followed the erased one:
+        // end() after erasing back(), begin() after erasing front().
+        iterator erase_after(iterator it) {
+            if (empty() || it == end()) {
+                throw std::runtime_error("Can't erase after end iterator");
+            }
+            Node* current_node = it.prev_ptr->next;
+            Node* node_delete = current_node->next;
+            if (node_delete == current_node) {
+                throw std::runtime_error("Can't erase, there is nothing after iterator");
+            }
+            current_node->next = node_delete->next;
+            if (node_delete == tail) {
+                tail = current_node;
+            }
+            bool wrapped = it.pos + 1 == sz;   // it was back(), so front() went
+            pool.destroy(node_delete);
+            sz--;
+            return wrapped ? begin() : iterator(current_node, it.pos + 1);
+        }
+
+        // Writes the list in the binary format of list_io.hpp, front to back.
+        // T must be trivially copyable.
+        void save(std::ostream& out) const requires std::is_trivially_copyable_v<T> {
+            io::StreamSink sink(out);
+            save_to(sink);
+        }
+
+        // Replaces the contents with a list written by save(). When the input can
+        // seek, all nodes are built in one bulk allocation; otherwise slabs grow as
+        // elements arrive, so a corrupt count can't force a huge allocation.
+        // Throws std::runtime_error on malformed input and leaves the list unchanged.
+        void load(std::istream& in) requires std::is_trivially_copyable_v<T> {
+            io::StreamSource source(in);
+            load_from(source);
+        }
+
+#ifdef DSA_LIST_HAS_FD_IO
+        // As above, on a POSIX file descriptor, starting at its current offset
+        void save(int fd) const requires std::is_trivially_copyable_v<T> {
+            io::FdSink sink(fd);
+            save_to(sink);
+        }
+
+        void load(int fd) requires std::is_trivially_copyable_v<T> {
+            io::FdSource source(fd);
+            load_from(source);
+        }
+#endif
+
     private:
+        // throws std::length_error unless n more elements fit in size_type
+        void check_room(std::size_t n = 1) const {
+            if (n > static_cast<std::size_t>(max_size() - sz)) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+        }
+
+        template <typename Sink>
+        void save_to(Sink& sink) const {
+            io::write_list<T>(sink, sz, [this](auto&& emit) {
+                if (empty()) {
+                    return;
+                }
+                Node* p = tail->next;
+                for (SizeType i = 0; i < sz; ++i, p = p->next) {
+                    emit(p->elem());
+                }
+            });
+        }
+
+        template <typename Source>
+        void load_from(Source& source) {
+            std::uint64_t n = io::read_header<T>(source);
+            if (n > static_cast<std::uint64_t>(max_size())) {
+                throw std::runtime_error("List load failed: too many elements");
+            }
+            std::uint64_t first = io::first_batch<T>(source, n);
+            CircularlyLinkedList fresh;
+            typename NodePool<Node>::Feed slots(fresh.pool, n, first);
+            io::read_elements<T>(source, n, [&fresh, &slots](const T& elem) {
+                Node* node = std::construct_at(slots.next(), elem);
+                if (fresh.tail == nullptr) {
+                    node->next = node;
+                } else {
+                    node->next = fresh.tail->next;
+                    fresh.tail->next = node;
+                }
+                fresh.tail = node;
+                fresh.sz++;
+            });
+            swap(*this, fresh);
+        }
+
+        // makes this list a copy of other, reusing existing nodes
+        void assign_from(const CircularlyLinkedList& other) {
+            SizeType common = sz < other.sz ? sz : other.sz;
+            Node* src = other.empty() ? nullptr : other.tail->next;
+            Node* last = tail;      // last node overwritten; tail if none
+            for (SizeType i = 0; i < common; ++i) {
+                last = last->next;
+                last->elem() = src->elem();
+                src = src->next;
+            }
+
+            if (sz > other.sz) {
+                // other is shorter: unlink the nodes after last and free them
+                Node* dst = last->next;
+                Node* head = tail->next;
+                for (SizeType i = common; i < sz; ++i) {
+                    Node* next = dst->next;
+                    pool.destroy(dst);
+                    dst = next;
+                }
+                if (common == 0) {
+                    tail = nullptr;
+                } else {
+                    last->next = head;
+                    tail = last;
+                }
+                sz = other.sz;
+            }
+            for (SizeType i = sz; i < other.sz; ++i) {
+                push_back(src->elem());
+                src = src->next;
+            }
+        }
+
         // presumes valid empty list when called
         void clone(const CircularlyLinkedList& other) {
             if (other.empty()) 
                 return;
 
             Node* current = other.tail->next;
-            for (int i = 0; i < other.sz; ++i) {
-                push_back(current->elem);
+            for (SizeType i = 0; i < other.sz; ++i) {
+                push_back(current->elem());
                 current = current->next;
             }
         }
@@ -158,6 +519,7 @@ class CircularlyLinkedList {
             using std::swap;
             swap(a.tail, b.tail);
             swap(a.sz, b.sz);
+            swap(a.pool, b.pool);
         }
 
         // Resets the list to empty
@@ -173,16 +535,18 @@ class CircularlyLinkedList {
         }
 
         // Copy assignment
+        // Copy-assigns into the nodes we already have and only allocates or
+        // frees the difference in size
         CircularlyLinkedList& operator=(const CircularlyLinkedList& other) {
             if (this != &other) {
-                clear();
-                clone(other);
+                assign_from(other);
             }
             return *this;
         }
 
         // Move constructor
-        CircularlyLinkedList(CircularlyLinkedList&& other) : sz(other.sz), tail(other.tail) {
+        CircularlyLinkedList(CircularlyLinkedList&& other)
+        : sz(other.sz), tail(other.tail), pool(std::move(other.pool)) {
              
                 other.tail = nullptr;
                 other.sz = 0;
@@ -195,6 +559,7 @@ class CircularlyLinkedList {
                 clear();
                 tail = other.tail;
                 sz = other.sz;
+                pool = std::move(other.pool);
 
                 other.tail = nullptr;
                 other.sz =  0;
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>      // provides std::atomic_thread_fence
+#include <memory>      // provides std::shared_ptr
+#include <utility>     // provides std::swap, std::move
+
+#include "doubly_linked.hpp"
+
+namespace dsa::list {
+
+// Copy-on-write handle to a DoublyLinkedList.
+// Copies share one node chain; the first mutation through a handle whose chain
+// is shared clones it privately (one clone(), paid only when a copy is actually
+// changed). Reading is done through the const interface or view(); every
+// mutation goes through a member here or through edit().
+// Sharing is tracked by std::shared_ptr, so handles to the same chain may be
+// used and copied on different threads as long as each handle stays with one.
+template <typename T>
+class CowDoublyLinkedList {
+    private:
+        std::shared_ptr<DoublyLinkedList<T>> list;
+
+        // makes our chain private before a change
+        DoublyLinkedList<T>& detach() {
+            if (list.use_count() > 1) {
+                list = std::make_shared<DoublyLinkedList<T>>(*list);
+            } else {
+                // pairs with the release in the other handles' shared_ptr decrements,
+                // so their last reads happen before our writes
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *list;
+        }
+
+    public:
+        using const_iterator = typename DoublyLinkedList<T>::const_iterator;
+        using size_type = typename DoublyLinkedList<T>::size_type;
+
+        // Constructs an empty list
+        CowDoublyLinkedList() : list{std::make_shared<DoublyLinkedList<T>>()} {}
+
+        // Takes over an existing list without copying it
+        explicit CowDoublyLinkedList(DoublyLinkedList<T>&& other)
+        : list{std::make_shared<DoublyLinkedList<T>>(std::move(other))} {}
+
+        // copying shares the chain: O(1)
+        CowDoublyLinkedList(const CowDoublyLinkedList&) = default;
+        CowDoublyLinkedList& operator=(const CowDoublyLinkedList&) = default;
+
+        // a moved-from handle is left empty but usable
+        CowDoublyLinkedList(CowDoublyLinkedList&& other) noexcept
+        : list{std::move(other.list)} {
+            other.list = std::make_shared<DoublyLinkedList<T>>();
+        }
+
+        CowDoublyLinkedList& operator=(CowDoublyLinkedList&& other) noexcept {
+            if (this != &other) {
+                list = std::move(other.list);
+                other.list = std::make_shared<DoublyLinkedList<T>>();
+            }
+            return *this;
+        }
+
+        friend void swap(CowDoublyLinkedList& a, CowDoublyLinkedList& b) noexcept {
+            using std::swap;
+            swap(a.list, b.list);
+        }
+
+        // true while both handles still share one chain
+        bool shares_with(const CowDoublyLinkedList& other) const {
+            return list == other.list;
+        }
+
+        // read access to the underlying list
+        const DoublyLinkedList<T>& view() const {
+            return *list;
+        }
+
+        // write access to the underlying list, cloning it first if shared;
+        // the reference is invalidated by copying this handle
+        DoublyLinkedList<T>& edit() {
+            return detach();
+        }
+
+        size_type size() const {
+            return list->size();
+        }
+
+        bool empty() const {
+            return list->empty();
+        }
+
+        const T& front() const {
+            return list->front();
+        }
+
+        const T& back() const {
+            return list->back();
+        }
+
+        const_iterator begin() const {
+            return static_cast<const DoublyLinkedList<T>&>(*list).begin();
+        }
+
+        const_iterator end() const {
+            return static_cast<const DoublyLinkedList<T>&>(*list).end();
+        }
+
+        void push_front(const T& elem) {
+            detach().push_front(elem);
+        }
+
+        void push_back(const T& elem) {
+            detach().push_back(elem);
+        }
+
+        void pop_front() {
+            if (!empty()) {
+                detach().pop_front();
+            }
+        }
+
+        void pop_back() {
+            if (!empty()) {
+                detach().pop_back();
+            }
+        }
+
+        // Empties this handle; other handles keep the shared chain
+        void clear() {
+            if (list.use_count() > 1) {
+                list = std::make_shared<DoublyLinkedList<T>>();
+            } else {
+                list->clear();
+            }
+        }
+
+        // Moves M's elements to the end of this list; M becomes empty.
+        // M's nodes are only copied if another handle still shares them.
+        void concatenate(CowDoublyLinkedList& M) {
+            if (this == &M || M.empty()) {
+                return;
+            }
+            DoublyLinkedList<T>& mine = detach();
+            mine.concatenate(M.detach());
+        }
+};
+
+}  // namespace dsa::list
@@ -1,26 +1,135 @@
 #pragma once
 
+#include <algorithm>   // provides std::max, std::min
+#include <cmath>       // provides std::sqrt
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>   // provides std::exception_ptr
+#include <functional>  // provides std::less
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>      // provides std::unique_ptr
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>     // provides std::swap
+#include <vector>
+
+#include "list_io.hpp"
+#include "node_layout.hpp"
+#include "node_pool.hpp"
+#include "parallel.hpp"
 
 namespace dsa::list {
 
 // doubly linked list, similar to std::list
-template <typename T>
+// SizeType counts the elements; std::uint32_t saves space for lists that stay small.
+// Layout places the element in the node (see node_layout.hpp).
+template <typename T, std::unsigned_integral SizeType = std::size_t, typename Layout = layout::inline_payload>
 class DoublyLinkedList {
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = SizeType;
+        using difference_type = std::ptrdiff_t;
+
     private:
-        class Node {
+        class alignas(Layout::node_alignment) alignas(T) Node {
             public:
                 Node* prev{nullptr};
                 Node* next{nullptr};
-                T elem;
+                typename Layout::template payload<T> data;
 
                 Node() {}
                 Node(const T& element, Node* prv, Node* nxt)
-                : elem{element}, prev{prv}, next{nxt} {}
+                : prev{prv}, next{nxt}, data{element} {}
+                // takes over other's element, for compact()
+                Node(Node&& other, Node* prv, Node* nxt)
+                : prev{prv}, next{nxt}, data{std::move(other.data)} {}
+
+                T& elem() { return data.get(); }
+                const T& elem() const { return data.get(); }
         };
         Node* header;
         Node* trailer;
-        int sz{0};
+        SizeType sz{0};
+
+        // Optional order-statistic index (see enable_order_index()).
+        // The nodes are grouped into consecutive blocks of about sqrt(n) nodes;
+        // each block records its first node and count. A node's block is found
+        // by walking back to a block's first node, so rank, nth and distance
+        // cost O(sqrt n) and no field is added to Node.
+        struct OrderIndex {
+            struct Block {
+                Node* first;
+                std::size_t count;
+            };
+            static constexpr std::size_t min_block = 32;
+
+            std::vector<Block> blocks;
+            std::unordered_map<const Node*, std::size_t> block_of;  // first node -> block number
+            std::size_t target{min_block};  // preferred block size
+            bool stale{false};      // true after changes the index couldn't follow
+
+            void renumber(std::size_t from = 0) {
+                for (std::size_t b = from; b < blocks.size(); ++b) {
+                    block_of[blocks[b].first] = b;
+                }
+            }
+
+            // block number of n and n's offset within it
+            std::pair<std::size_t, std::size_t> locate(const Node* n) const {
+                std::size_t offset = 0;
+                for (;;) {
+                    auto found = block_of.find(n);
+                    if (found != block_of.end()) {
+                        return {found->second, offset};
+                    }
+                    n = n->prev;
+                    ++offset;
+                }
+            }
+        };
+        std::unique_ptr<OrderIndex> order;
+        NodePool<Node> pool;  // element nodes; the sentinels are allocated separately
+
+        // State of an incremental compact() pass: the first used slots of slab
+        // hold the nodes relocated so far, in list order, and last is the most
+        // recent of them (nullptr before the first).
+        struct Compaction {
+            Node* slab;
+            SizeType capacity;
+            SizeType used;
+            Node* last;
+        };
+        std::unique_ptr<Compaction> compaction;
+
+        // ends a compact() pass, handing the slab's unused slots to the pool
+        // and freeing the slabs the pass has emptied
+        void stop_compaction() {
+            if (!compaction) {
+                return;
+            }
+            for (SizeType i = compaction->used; i < compaction->capacity; ++i) {
+                pool.deallocate(compaction->slab + i);
+            }
+            compaction.reset();
+            pool.release_empty_slabs();
+        }
+
+        // moves node into the storage at slot and links the copy in its place
+        Node* relocate(Node* node, Node* slot) {
+            Node* moved = std::construct_at(slot, std::move(*node), node->prev, node->next);
+            moved->prev->next = moved;
+            moved->next->prev = moved;
+            pool.destroy(node);
+            return moved;
+        }
 
         // utility to configure an empty list
         void create_sentinels() {
@@ -37,10 +146,16 @@ class DoublyLinkedList {
             create_sentinels();
         }
 
-        int size() const {
+        size_type size() const {
             return sz;
         }
 
+        // largest size the size type can count; growing past it throws
+        // std::length_error
+        static constexpr size_type max_size() {
+            return std::numeric_limits<size_type>::max();
+        }
+
         bool empty() const { 
             return sz == 0;
         }
@@ -49,37 +164,152 @@ class DoublyLinkedList {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return header->next->elem;
+            return header->next->elem();
         }
 
         const T& front() const {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return header->next->elem;
+            return header->next->elem();
         }
 
         T& back() { 
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return trailer->prev->elem;
+            return trailer->prev->elem();
         }
 
         const T& back() const { 
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return trailer->prev->elem;
+            return trailer->prev->elem();
         }
 
     private:
+        // regroups all nodes into blocks of about sqrt(sz)
+        void rebuild_order_index() {
+            OrderIndex& ix = *order;
+            ix.blocks.clear();
+            ix.block_of.clear();
+            ix.stale = false;
+            ix.target = std::max(OrderIndex::min_block, static_cast<std::size_t>(std::sqrt(static_cast<double>(sz))));
+            std::size_t filled = ix.target;
+            for (Node* p = header->next; p != trailer; p = p->next) {
+                if (filled == ix.target) {
+                    ix.blocks.push_back({p, 0});
+                    filled = 0;
+                }
+                ix.blocks.back().count++;
+                filled++;
+            }
+            ix.renumber();
+        }
+
+        // usable index or nullptr; rebuilds a stale one
+        OrderIndex* order_index() {
+            if (order && order->stale) {
+                rebuild_order_index();
+            }
+            return order.get();
+        }
+
+        // keeps the index in step with a node just linked into the list;
+        // O(1) at either end, O(sqrt n) in the middle
+        void index_inserted(Node* node) {
+            if (!order || order->stale) {
+                return;
+            }
+            OrderIndex& ix = *order;
+            std::size_t b;
+            if (ix.blocks.empty()) {
+                ix.blocks.push_back({node, 0});
+                ix.block_of[node] = 0;
+                b = 0;
+            } else if (node->prev == header) {
+                ix.block_of.erase(ix.blocks[0].first);
+                ix.blocks[0].first = node;
+                ix.block_of[node] = 0;
+                b = 0;
+            } else if (node->next == trailer) {
+                b = ix.blocks.size() - 1;
+            } else {
+                b = ix.locate(node->prev).first;
+            }
+
+            if (++ix.blocks[b].count > 2 * ix.target) {
+                // split the block in half
+                Node* mid = ix.blocks[b].first;
+                std::size_t half = ix.blocks[b].count / 2;
+                for (std::size_t i = 0; i < half; ++i) {
+                    mid = mid->next;
+                }
+                ix.blocks.insert(ix.blocks.begin() + b + 1, {mid, ix.blocks[b].count - half});
+                ix.blocks[b].count = half;
+                ix.renumber(b + 1);
+            }
+            if (sz > 4 * ix.target * ix.target) {
+                rebuild_order_index();
+            }
+        }
+
+        // keeps the index in step with a node about to be unlinked
+        void index_erasing(Node* node) {
+            if (!order || order->stale) {
+                return;
+            }
+            OrderIndex& ix = *order;
+            std::size_t last = ix.blocks.size() - 1;
+            std::pair<std::size_t, std::size_t> where;
+            if (node == header->next) {
+                where = {0, 0};
+            } else if (node == trailer->prev && ix.blocks[last].first != node) {
+                where = {last, 1};
+            } else {
+                where = ix.locate(node);
+            }
+            auto [b, offset] = where;
+
+            if (--ix.blocks[b].count == 0) {
+                ix.block_of.erase(node);
+                ix.blocks.erase(ix.blocks.begin() + b);
+                ix.renumber(b);
+                return;
+            }
+            if (offset == 0) {
+                ix.block_of.erase(node);
+                ix.blocks[b].first = node->next;
+                ix.block_of[node->next] = b;
+            }
+            // merge with the following block when both have become small
+            if (b < last && ix.blocks[b].count + ix.blocks[b + 1].count <= ix.target) {
+                ix.blocks[b].count += ix.blocks[b + 1].count;
+                ix.block_of.erase(ix.blocks[b + 1].first);
+                ix.blocks.erase(ix.blocks.begin() + b + 1);
+                ix.renumber(b + 1);
+            }
+            if (ix.target > OrderIndex::min_block && static_cast<std::size_t>(sz) - 1 < ix.target * ix.target / 4) {
+                ix.stale = true;
+            }
+        }
+
+        // throws std::length_error unless n more elements fit in size_type
+        void check_room(std::size_t n = 1) const {
+            if (n > static_cast<std::size_t>(max_size() - sz)) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+        }
+
         Node* insert_before(T elem, Node* successor) {
+            check_room();
             Node* previous_successor = successor->prev;
-            Node* new_node = new Node(elem, previous_successor, successor);
+            Node* new_node = pool.create(elem, previous_successor, successor);
             previous_successor->next = new_node;
             successor->prev = new_node;
             sz++;
+            index_inserted(new_node);
             return new_node; 
         }
 
@@ -87,11 +317,15 @@ class DoublyLinkedList {
             if (node == header || node == trailer) {
                 throw std::runtime_error("Cant erase nodes");
             }
+            index_erasing(node);
             Node* previous_successor = node->prev;
             Node* successor = node->next;
             previous_successor->next = successor;
             successor->prev = previous_successor;
-            delete node;
+            if (compaction && compaction->last == node) {
+                stop_compaction();   // the pass can't resume from a node that's gone
+            }
+            pool.destroy(node);
             sz--;
         }
 
@@ -120,11 +354,13 @@ class DoublyLinkedList {
         // After the operation, M becomes an empty list
         // No nodes are copied or allocated; only pointer links are adjusted.
         // Does nothing if M is empty or if this and M are the same list.
-        void concat(DoublyLinkedList& M) {
+        void concatenate(DoublyLinkedList& M) {
             if (this == &M) 
                 return; // self-concat not allowed
             if (M.sz == 0) 
                 return;  // nothing to add
+            check_room(M.sz);
+            M.stop_compaction();
 
             if (sz == 0) {
                 Node* M_first_node = M.header->next;
@@ -148,6 +384,21 @@ class DoublyLinkedList {
                 M_last_node->next = trailer;
             }
 
+            if (order && !order->stale) {
+                if (M.order && !M.order->stale) {
+                    std::size_t from = order->blocks.size();
+                    order->blocks.insert(order->blocks.end(), M.order->blocks.begin(), M.order->blocks.end());
+                    order->renumber(from);
+                } else {
+                    order->stale = true;
+                }
+            }
+            pool.adopt(M.pool);   // M's nodes may live in its slabs
+            if (M.order) {
+                M.order->blocks.clear();
+                M.order->block_of.clear();
+                M.order->stale = false;
+            }
             sz += M.sz;
 
             M.header->next = M.trailer;
@@ -155,22 +406,32 @@ class DoublyLinkedList {
             M.sz = 0;
         }
 
+        class const_iterator;
+
+        // models std::bidirectional_iterator
         class iterator {
             // needed for DoublyLinkedList's insert and erase
             friend class DoublyLinkedList;
+            friend class const_iterator;
 
             private:
                 Node* node_ptr;  // pointer to a node
 
             public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
                 iterator(Node* ptr = nullptr) 
                 : node_ptr(ptr) {}
 
                 T& operator*() const {
-                    return node_ptr->elem;
+                    return node_ptr->elem();
                 }
                 T* operator->() const {
-                    return &(node_ptr->elem);
+                    return &(node_ptr->elem());
                 }
                 iterator& operator++() {
                     node_ptr = node_ptr->next;
@@ -203,14 +464,22 @@ class DoublyLinkedList {
                 const Node* node_ptr;
 
             public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
                 const_iterator(const Node* ptr = nullptr) 
                 : node_ptr(ptr) {}
+                const_iterator(iterator it)
+                : node_ptr(it.node_ptr) {}
 
                 const T& operator*() const { 
-                    return node_ptr->elem;
+                    return node_ptr->elem();
                 }
                 const T* operator->() const { 
-                    return &(node_ptr->elem);
+                    return &(node_ptr->elem());
                 }
                 const_iterator& operator++() {
                     node_ptr = node_ptr->next;
@@ -255,6 +524,41 @@ class DoublyLinkedList {
             return const_iterator(trailer);
         }
 
+        const_iterator cbegin() const {
+            return begin();
+        }
+
+        const_iterator cend() const {
+            return end();
+        }
+
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        reverse_iterator rbegin() {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend() {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crbegin() const {
+            return rbegin();
+        }
+
+        const_reverse_iterator crend() const {
+            return rend();
+        }
+
         iterator insert(iterator it, const T& elem) {
             Node* new_node = insert_before(elem, it.node_ptr);
             return iterator(new_node);
@@ -269,22 +573,845 @@ class DoublyLinkedList {
             return iterator(successor);
         }
 
+        // Removes every element for which pred returns true and returns how many
+        // were removed. Matches are unlinked in one pass onto a detached chain
+        // that is freed at the end, and an order index is rebuilt on its next
+        // use rather than updated per node. If pred throws, the elements
+        // removed so far stay removed.
+        template <typename Pred>
+        size_type remove_if(Pred pred) {
+            Node* removed = nullptr;
+            Node** removed_end = &removed;
+            size_type count = 0;
+            try {
+                for (Node* node = header->next; node != trailer;) {
+                    Node* next = node->next;
+                    if (pred(node->elem())) {
+                        node->prev->next = next;
+                        next->prev = node->prev;
+                        *removed_end = node;
+                        removed_end = &node->next;
+                        count++;
+                    }
+                    node = next;
+                }
+            } catch (...) {
+                finish_removal(removed, removed_end, count);
+                throw;
+            }
+            finish_removal(removed, removed_end, count);
+            return count;
+        }
+
+        size_type remove(const T& value) {
+            return remove_if([&value](const T& elem) { return elem == value; });
+        }
+
+        // Removes all but the first of each run of consecutive elements for
+        // which eq(kept, elem) is true, batching the frees like remove_if().
+        template <typename BinaryPred>
+        size_type unique(BinaryPred eq) {
+            if (sz <= 1) {
+                return 0;
+            }
+            Node* removed = nullptr;
+            Node** removed_end = &removed;
+            size_type count = 0;
+            try {
+                Node* kept = header->next;
+                for (Node* node = kept->next; node != trailer;) {
+                    Node* next = node->next;
+                    if (eq(kept->elem(), node->elem())) {
+                        kept->next = next;
+                        next->prev = kept;
+                        *removed_end = node;
+                        removed_end = &node->next;
+                        count++;
+                    } else {
+                        kept = node;
+                    }
+                    node = next;
+                }
+            } catch (...) {
+                finish_removal(removed, removed_end, count);
+                throw;
+            }
+            finish_removal(removed, removed_end, count);
+            return count;
+        }
+
+        size_type unique() {
+            return unique([](const T& a, const T& b) { return a == b; });
+        }
+
+        // Moves the element at it, from other (which may be this list), to just
+        // before pos. O(1): no node is allocated, freed or copied, and iterators
+        // to the moved element stay valid (they now refer into this list).
+        void splice(iterator pos, DoublyLinkedList& other, iterator it) {
+            Node* node = it.node_ptr;
+            if (node == other.header || node == other.trailer) {
+                throw std::runtime_error("Cant splice end() iterator");
+            }
+            if (node == pos.node_ptr || node->next == pos.node_ptr) {
+                return;   // already in place
+            }
+            if (&other != this) {
+                check_room();
+            } else if (compaction && compaction->last == node) {
+                // the pass resumes after the node's old place, not its new one
+                compaction->last = (node->prev == header) ? nullptr : node->prev;
+            }
+            other.index_erasing(node);
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            other.sz--;
+            if (&other != this) {
+                pool.adopt(other.pool);
+                if (other.compaction && other.compaction->last == node) {
+                    other.stop_compaction();
+                }
+            }
+
+            Node* successor = pos.node_ptr;
+            Node* previous_successor = successor->prev;
+            node->prev = previous_successor;
+            node->next = successor;
+            previous_successor->next = node;
+            successor->prev = node;
+            sz++;
+            index_inserted(node);
+        }
+
+        // Reverses the list in place in O(n) by swapping each node's links.
+        // No element is moved or copied and iterators stay valid, now running
+        // the other way.
+        void reverse() {
+            reverse(begin(), end());
+        }
+
+        // Reverses the elements in [first, last) by relinking their nodes.
+        // O(distance(first, last)); iterators stay valid.
+        void reverse(iterator first, iterator last) {
+            Node* a = first.node_ptr;
+            Node* after = last.node_ptr;
+            if (a == after || a->next == after) {
+                return;   // fewer than two elements
+            }
+            Node* before = a->prev;
+            Node* z = after->prev;
+            for (Node* p = a; p != after;) {
+                Node* next = p->next;
+                std::swap(p->prev, p->next);
+                p = next;
+            }
+            before->next = z;
+            z->prev = before;
+            a->next = after;
+            after->prev = a;
+            if (order) {
+                order->stale = true;
+            }
+            stop_compaction();   // relocated nodes would no longer be a prefix
+        }
+
+    private:
+        // Back-to-front view of a list, returned by reversed().
+        template <bool Const>
+        class ReversedView {
+            using List = std::conditional_t<Const, const DoublyLinkedList, DoublyLinkedList>;
+            using NodePtr = std::conditional_t<Const, const Node*, Node*>;
+            using Ref = std::conditional_t<Const, const T&, T&>;
+
+            List* list;
+
+            public:
+                class iterator {
+                    private:
+                        NodePtr node_ptr;
+
+                    public:
+                        using iterator_category = std::bidirectional_iterator_tag;
+                        using value_type = T;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = std::conditional_t<Const, const T*, T*>;
+                        using reference = Ref;
+
+                        iterator(NodePtr ptr = nullptr)
+                        : node_ptr(ptr) {}
+
+                        Ref operator*() const {
+                            return node_ptr->elem();
+                        }
+                        pointer operator->() const {
+                            return &(node_ptr->elem());
+                        }
+                        iterator& operator++() {
+                            node_ptr = node_ptr->prev;
+                            return *this;
+                        }
+                        iterator operator++(int) {
+                            iterator old = *this;
+                            ++(*this);
+                            return old;
+                        }
+                        iterator& operator--() {
+                            node_ptr = node_ptr->next;
+                            return *this;
+                        }
+                        iterator operator--(int) {
+                            iterator old = *this;
+                            --(*this);
+                            return old;
+                        }
+                        bool operator==(const iterator& other) const {
+                            return node_ptr == other.node_ptr;
+                        }
+                        bool operator!=(const iterator& other) const {
+                            return node_ptr != other.node_ptr;
+                        }
+                };
+
+                explicit ReversedView(List* l)
+                : list(l) {}
+
+                iterator begin() const {
+                    return iterator(list->trailer->prev);
+                }
+                iterator end() const {
+                    return iterator(list->header);
+                }
+                size_type size() const {
+                    return list->size();
+                }
+                bool empty() const {
+                    return list->empty();
+                }
+                Ref front() const {
+                    return list->back();
+                }
+                Ref back() const {
+                    return list->front();
+                }
+        };
+
+    public:
+        using reversed_view = ReversedView<false>;
+        using const_reversed_view = ReversedView<true>;
+
+        // The list seen back to front, in O(1) and without touching any node.
+        // The view follows later changes to the list; reverse() changes the
+        // order itself.
+        reversed_view reversed() {
+            return reversed_view(this);
+        }
+
+        const_reversed_view reversed() const {
+            return const_reversed_view(this);
+        }
+
+        // Moves every node into one new block, in list order, and frees the old
+        // storage, so traversal walks memory sequentially again. O(n). Elements
+        // are moved, not copied; iterators and references are invalidated.
+        void compact() requires std::is_nothrow_move_constructible_v<typename Layout::template payload<T>> {
+            stop_compaction();
+            if (sz == 0) {
+                return;
+            }
+            NodePool<Node> fresh;
+            Node* slots = fresh.bulk(sz);
+            for (Node* p = header->next; p != trailer; p = p->next) {
+                p = relocate(p, slots++);
+            }
+            swap(pool, fresh);   // the old pool and its slabs go now (unless shared)
+            if (order) {
+                order->stale = true;
+            }
+        }
+
+        // slabs backing this list's nodes, and the node slots in them, used or free
+        std::size_t slab_count() const {
+            return pool.slab_count();
+        }
+
+        std::size_t slab_capacity() const {
+            return pool.slab_capacity();
+        }
+
+        // Incremental compact(): relocates at most budget nodes into a block
+        // reserved for the pass and returns true once the pass is complete.
+        // Call it again to continue; the list may be changed between calls. A
+        // pass stops early if the last node it relocated is erased or moved to
+        // another list. When a pass ends, slabs it left with no nodes are freed,
+        // so repeated passes don't pile up storage. Iterators and references to
+        // relocated nodes are invalidated, and an order index is rebuilt on its
+        // next use.
+        bool compact(size_type budget) requires std::is_nothrow_move_constructible_v<typename Layout::template payload<T>> {
+            if (!compaction) {
+                if (sz == 0) {
+                    return true;
+                }
+                compaction = std::make_unique<Compaction>(Compaction{pool.bulk(sz), sz, 0, nullptr});
+            }
+            Compaction& c = *compaction;
+            Node* p = (c.last == nullptr) ? header->next : c.last->next;
+            for (; budget > 0 && p != trailer && c.used < c.capacity; --budget) {
+                c.last = relocate(p, c.slab + c.used++);
+                p = c.last->next;
+            }
+            if (order && c.last != nullptr) {
+                order->stale = true;
+            }
+            if (p == trailer || c.used == c.capacity) {
+                stop_compaction();
+                return true;
+            }
+            return false;
+        }
+
+        // Turns on the order-statistic index, making nth, advance and distance
+        // O(sqrt n). Costs O(n) once, then O(1) extra per push/pop at the ends
+        // and O(sqrt n) per insert/erase in the middle.
+        void enable_order_index() {
+            if (!order) {
+                order = std::make_unique<OrderIndex>();
+                rebuild_order_index();
+            }
+        }
+
+        void disable_order_index() {
+            order.reset();
+        }
+
+        bool has_order_index() const {
+            return order != nullptr;
+        }
+
+        // position of it in the list; end() is at size()
+        size_type rank(iterator it) {
+            if (it.node_ptr == trailer) {
+                return sz;
+            }
+            if (OrderIndex* ix = order_index()) {
+                auto [b, offset] = ix->locate(it.node_ptr);
+                size_type pos = offset;
+                for (std::size_t i = 0; i < b; ++i) {
+                    pos += ix->blocks[i].count;
+                }
+                return pos;
+            }
+            size_type pos = 0;
+            for (Node* p = it.node_ptr->prev; p != header; p = p->prev) {
+                pos++;
+            }
+            return pos;
+        }
+
+        // Iterator to the element at position k (0 <= k <= size(), size() gives end())
+        iterator nth(size_type k) {
+            if (k > sz) {
+                throw std::out_of_range("Index out of range");
+            }
+            if (k == sz) {
+                return end();
+            }
+            Node* p;
+            if (OrderIndex* ix = order_index()) {
+                std::size_t b = 0;
+                while (k >= ix->blocks[b].count) {
+                    k -= ix->blocks[b].count;
+                    b++;
+                }
+                p = ix->blocks[b].first;
+                for (; k > 0; --k) {
+                    p = p->next;
+                }
+            } else if (k <= sz / 2) {
+                p = header->next;
+                for (; k > 0; --k) {
+                    p = p->next;
+                }
+            } else {
+                p = trailer->prev;
+                for (size_type i = sz - 1; i > k; --i) {
+                    p = p->prev;
+                }
+            }
+            return iterator(p);
+        }
+
+        // Moves it by k positions (k may be negative); throws std::out_of_range
+        // if the result would fall outside [begin(), end()]
+        iterator advance(iterator it, difference_type k) {
+            if (order) {
+                difference_type target = static_cast<difference_type>(rank(it)) + k;
+                if (target < 0) {
+                    throw std::out_of_range("Advanced before begin");
+                }
+                return nth(static_cast<size_type>(target));
+            }
+            Node* p = it.node_ptr;
+            for (; k > 0; --k) {
+                if (p == trailer) {
+                    throw std::out_of_range("Advanced past end");
+                }
+                p = p->next;
+            }
+            for (; k < 0; ++k) {
+                if (p->prev == header) {
+                    throw std::out_of_range("Advanced before begin");
+                }
+                p = p->prev;
+            }
+            return iterator(p);
+        }
+
+        // Number of increments from a to b (negative if b comes before a)
+        difference_type distance(iterator a, iterator b) {
+            if (order) {
+                return static_cast<difference_type>(rank(b)) - static_cast<difference_type>(rank(a));
+            }
+            difference_type d = 0;
+            for (Node* p = a.node_ptr; p != trailer; p = p->next, ++d) {
+                if (p == b.node_ptr) {
+                    return d;
+                }
+            }
+            if (b.node_ptr == trailer) {
+                return d;
+            }
+            d = 0;
+            for (Node* p = a.node_ptr; p != b.node_ptr; p = p->prev) {
+                d--;
+            }
+            return d;
+        }
+
+
+        // Writes the list in the binary format of list_io.hpp: a header, then all
+        // elements back to back. T must be trivially copyable.
+        void save(std::ostream& out) const requires std::is_trivially_copyable_v<T> {
+            io::StreamSink sink(out);
+            save_to(sink);
+        }
+
+        // Replaces the contents with a list written by save(). When the input can
+        // seek, all nodes are built in one bulk allocation; otherwise slabs grow as
+        // elements arrive, so a corrupt count can't force a huge allocation.
+        // Throws std::runtime_error on malformed input and leaves the list unchanged.
+        void load(std::istream& in) requires std::is_trivially_copyable_v<T> {
+            io::StreamSource source(in);
+            load_from(source);
+        }
+
+#ifdef DSA_LIST_HAS_FD_IO
+        // As above, on a POSIX file descriptor, starting at its current offset
+        void save(int fd) const requires std::is_trivially_copyable_v<T> {
+            io::FdSink sink(fd);
+            save_to(sink);
+        }
+
+        void load(int fd) requires std::is_trivially_copyable_v<T> {
+            io::FdSource source(fd);
+            load_from(source);
+        }
+#endif
 
     private:
+        template <typename Sink>
+        void save_to(Sink& sink) const {
+            io::write_list<T>(sink, sz, [this](auto&& emit) {
+                for (Node* p = header->next; p != trailer; p = p->next) {
+                    emit(p->elem());
+                }
+            });
+        }
+
+        template <typename Source>
+        void load_from(Source& source) {
+            std::uint64_t n = io::read_header<T>(source);
+            if (n > static_cast<std::uint64_t>(max_size())) {
+                throw std::runtime_error("List load failed: too many elements");
+            }
+            std::uint64_t first = io::first_batch<T>(source, n);
+            DoublyLinkedList fresh;
+            typename NodePool<Node>::Feed slots(fresh.pool, n, first);
+            io::read_elements<T>(source, n, [&fresh, &slots](const T& elem) {
+                Node* last = fresh.trailer->prev;
+                Node* node = std::construct_at(slots.next(), elem, last, fresh.trailer);
+                last->next = node;
+                fresh.trailer->prev = node;
+                fresh.sz++;
+            });
+            if (order) {
+                fresh.enable_order_index();
+            }
+            swap(*this, fresh);
+        }
+
+        // makes this list a copy of other, reusing existing nodes
+        void assign_from(const DoublyLinkedList& other) {
+            if (header == nullptr) {    // moved from
+                create_sentinels();
+            }
+            Node* src = other.header->next;
+            Node* dst = header->next;
+            while (src != other.trailer && dst != trailer) {
+                dst->elem() = src->elem();
+                src = src->next;
+                dst = dst->next;
+            }
+            // pop_back/push_back keep the order index in step
+            while (sz > other.sz) {
+                pop_back();
+            }
+            for (; src != other.trailer; src = src->next) {
+                push_back(src->elem());
+            }
+        }
+
+        // frees the chain built by remove_if() or unique()
+        void finish_removal(Node* removed, Node** removed_end, size_type count) {
+            if (count == 0) {
+                return;
+            }
+            *removed_end = nullptr;
+            sz -= count;
+            if (order) {
+                order->stale = true;
+            }
+            if (compaction) {
+                for (Node* p = removed; p != nullptr; p = p->next) {
+                    if (p == compaction->last) {
+                        stop_compaction();   // the pass can't resume from a node that's gone
+                        break;
+                    }
+                }
+            }
+            pool.destroy_chain(removed);
+        }
+
+        // A chain of nodes taken out of a list, ending in nullptr. Every node
+        // but first has a valid prev link.
+        struct Run {
+            Node* first{nullptr};
+            Node* last{nullptr};
+            std::size_t count{0};
+        };
+
+        // takes all nodes out as a run, leaving the list empty
+        Run detach_all() {
+            stop_compaction();
+            Run run{header->next, trailer->prev, sz};
+            run.last->next = nullptr;
+            header->next = trailer;
+            trailer->prev = header;
+            sz = 0;
+            if (order) {
+                order->stale = true;
+            }
+            return run;
+        }
+
+        // links a run in at the back in O(1); its nodes must be in our pool
+        void append_run(const Run& run) {
+            if (run.count == 0) {
+                return;
+            }
+            Node* before = trailer->prev;
+            before->next = run.first;
+            run.first->prev = before;
+            run.last->next = trailer;
+            trailer->prev = run.last;
+            sz += static_cast<SizeType>(run.count);
+            if (order) {
+                order->stale = true;
+            }
+        }
+
+        // Calls f(i) for every i < n as up to `tasks` tasks on the shared worker
+        // pool (the caller's thread included). Waits for all of them, then
+        // rethrows the first exception.
+        template <typename Function>
+        static void for_each_index(std::size_t n, std::size_t tasks, Function f) {
+            if (n == 0) {
+                return;
+            }
+            std::size_t strides = std::min(tasks, n);
+            detail::WorkerPool::shared().run(strides, [&f, n, strides](std::size_t from) {
+                for (std::size_t i = from; i < n; i += strides) {
+                    f(i);
+                }
+            });
+        }
+
+        // Merges sorted runs into one with a loser tree: each element costs
+        // about log2(runs) comparisons and no node is allocated or copied.
+        // Equal elements keep the order of their runs. If comp throws, runs is
+        // left holding the merged prefix and the rest of every run, so no node
+        // is lost.
+        template <typename Compare>
+        static Run merge_runs(std::vector<Run>& runs, Compare& comp) {
+            const std::size_t k = runs.size();
+            if (k <= 1) {
+                Run only = (k == 0) ? Run{} : runs[0];
+                runs.clear();
+                return only;
+            }
+            // a run's current head, nullptr once the run is used up
+            struct Entry {
+                Node* head;
+                std::size_t run;
+            };
+            // true when x's head goes out before y's; an empty run never does
+            auto before = [&comp](const Entry& x, const Entry& y) {
+                if (x.head == nullptr || y.head == nullptr) {
+                    return y.head == nullptr && x.head != nullptr;
+                }
+                return x.run < y.run ? !comp(y.head->elem(), x.head->elem())
+                                     : comp(x.head->elem(), y.head->elem());
+            };
+
+            // tree[0] is the run holding the smallest head; tree[n] for n > 0
+            // is the loser of the match at internal node n, whose children are
+            // 2n and 2n + 1; run i sits at leaf k + i. Entries carry the head
+            // itself so a match reads one node and no side table.
+            std::vector<Entry> tree(k);
+            std::vector<Run> rest;
+            rest.reserve(k + 1);   // so handing the nodes back can't throw
+            Run out;
+            try {
+                std::vector<Entry> winner(2 * k);
+                for (std::size_t i = 0; i < k; ++i) {
+                    winner[k + i] = Entry{runs[i].first, i};
+                }
+                for (std::size_t n = k - 1; n > 0; --n) {
+                    const Entry& l = winner[2 * n];
+                    const Entry& r = winner[2 * n + 1];
+                    bool left_wins = before(l, r);
+                    winner[n] = left_wins ? l : r;
+                    tree[n] = left_wins ? r : l;
+                }
+                tree[0] = winner[1];
+
+                while (tree[0].head != nullptr) {
+                    Entry w = tree[0];
+                    Node* node = w.head;
+                    w.head = node->next;
+                    runs[w.run].first = w.head;
+                    runs[w.run].count--;
+                    if (out.last == nullptr) {
+                        out.first = node;
+                    } else {
+                        out.last->next = node;
+                        node->prev = out.last;
+                    }
+                    out.last = node;
+                    out.count++;
+                    for (std::size_t n = (w.run + k) / 2; n > 0; n /= 2) {
+                        // select rather than branch: the outcome is unpredictable
+                        Entry other = tree[n];
+                        bool other_first = before(other, w);
+                        tree[n] = other_first ? w : other;
+                        w = other_first ? other : w;
+                    }
+                    tree[0] = w;
+                }
+            } catch (...) {
+                if (out.count > 0) {
+                    out.last->next = nullptr;
+                    rest.push_back(out);
+                }
+                for (const Run& run : runs) {
+                    if (run.first != nullptr) {
+                        rest.push_back(run);
+                    }
+                }
+                runs.swap(rest);
+                throw;
+            }
+            out.last->next = nullptr;
+            runs.clear();
+            return out;
+        }
+
+        // merge_runs() over `parts` threads: splitters picked from a weighted
+        // sample of every run divide the keys into `parts` disjoint ranges,
+        // every run is cut at the splitters, and each range is merged on its
+        // own thread. The ranges are then joined in order. Keeps merge_runs'
+        // guarantees if comp throws.
+        template <typename Compare>
+        static Run merge_runs_parallel(std::vector<Run>& runs, std::size_t total, Compare& comp, std::size_t parts) {
+            const std::size_t k = runs.size();
+
+            // up to `parts` evenly spaced samples per run, each weighted by the
+            // number of elements it stands for
+            struct Sample {
+                const Node* node;
+                std::size_t weight;
+            };
+            std::vector<std::vector<Sample>> samples(k);
+            for_each_index(k, parts, [&](std::size_t r) {
+                std::size_t count = runs[r].count;
+                std::size_t s = std::min(parts, count);
+                const Node* node = runs[r].first;
+                std::size_t pos = 0;
+                for (std::size_t i = 0; i < s; ++i) {
+                    std::size_t from = i * count / s;
+                    std::size_t to = (i + 1) * count / s;
+                    for (; pos < (from + to) / 2; ++pos) {
+                        node = node->next;
+                    }
+                    samples[r].push_back(Sample{node, to - from});
+                }
+            });
+            std::vector<Sample> all;
+            for (auto& run_samples : samples) {
+                all.insert(all.end(), run_samples.begin(), run_samples.end());
+            }
+            std::sort(all.begin(), all.end(), [&comp](const Sample& a, const Sample& b) {
+                return comp(a.node->elem(), b.node->elem());
+            });
+            std::vector<const Node*> splitters;   // range p holds keys in [splitters[p - 1], splitters[p])
+            std::size_t weight = 0;
+            for (const Sample& sample : all) {
+                weight += sample.weight;
+                while (splitters.size() + 1 < parts && weight * parts >= total * (splitters.size() + 1)) {
+                    splitters.push_back(sample.node);
+                }
+            }
+
+            // find every run's cut points first, then cut, so a throwing comp
+            // leaves the runs whole
+            std::vector<std::vector<Run>> pieces(k, std::vector<Run>(parts));   // pieces[run][range]
+            for_each_index(k, parts, [&](std::size_t r) {
+                std::size_t range = 0;
+                for (Node* node = runs[r].first; node != nullptr; node = node->next) {
+                    while (range < splitters.size() && !comp(node->elem(), splitters[range]->elem())) {
+                        ++range;
+                    }
+                    Run& piece = pieces[r][range];
+                    if (piece.first == nullptr) {
+                        piece.first = node;
+                    }
+                    piece.last = node;
+                    piece.count++;
+                }
+            });
+            std::vector<std::vector<Run>> ranges(parts);
+            for (std::size_t p = 0; p < parts; ++p) {
+                ranges[p].reserve(k);
+            }
+            for (std::size_t r = 0; r < k; ++r) {
+                for (std::size_t p = 0; p < parts; ++p) {
+                    if (pieces[r][p].count > 0) {
+                        pieces[r][p].last->next = nullptr;
+                        ranges[p].push_back(pieces[r][p]);
+                    }
+                }
+            }
+            runs.clear();
+
+            std::vector<Run> merged(parts);
+            std::exception_ptr error;
+            try {
+                for_each_index(parts, parts, [&](std::size_t p) {
+                    merged[p] = merge_runs(ranges[p], comp);
+                });
+            } catch (...) {
+                error = std::current_exception();
+            }
+            Run out;
+            for (std::size_t p = 0; p < parts; ++p) {
+                if (error) {
+                    // hand back each range's result or, if it failed, its leftovers
+                    if (merged[p].count > 0) {
+                        runs.push_back(merged[p]);
+                    }
+                    runs.insert(runs.end(), ranges[p].begin(), ranges[p].end());
+                } else if (merged[p].count > 0) {
+                    if (out.last == nullptr) {
+                        out.first = merged[p].first;
+                    } else {
+                        out.last->next = merged[p].first;
+                        merged[p].first->prev = out.last;
+                    }
+                    out.last = merged[p].last;
+                    out.count += merged[p].count;
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return out;
+        }
+
         // presumes valid empty list when called
         void clone(const DoublyLinkedList& other) {
             for (Node* p = other.header->next; p != other.trailer; p = p->next) {
-                push_back(p->elem);
+                push_back(p->elem());
             }
         }
 
         public:
+        // Merges sorted lists (by comp) into one, leaving them empty. Nodes
+        // are relinked, never allocated or copied, through a loser tree over
+        // the list heads: O(n log k) for n elements in k lists. Equal elements
+        // keep the order of the lists they came from.
+        // With threads != 1 (0 for std::thread::hardware_concurrency()) a large
+        // merge is split into disjoint key ranges merged on separate threads;
+        // comp must then be safe to call concurrently.
+        // If comp throws, every element ends up, in no particular order, in the
+        // first list that hasn't been moved from. Throws std::length_error,
+        // before touching any list, if the total won't fit in size_type.
+        template <typename Compare = std::less<>>
+        friend DoublyLinkedList merge_k(std::span<DoublyLinkedList> lists, Compare comp = {}, unsigned threads = 1) {
+            std::size_t total = 0;
+            for (DoublyLinkedList& list : lists) {
+                if (list.header != nullptr) {
+                    total += list.sz;
+                }
+            }
+            if (total > max_size()) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+
+            DoublyLinkedList out;
+            std::vector<Run> runs;
+            for (DoublyLinkedList& list : lists) {
+                if (list.header != nullptr && list.sz > 0) {
+                    runs.push_back(list.detach_all());
+                    out.pool.adopt(list.pool);   // the nodes may live in its slabs
+                }
+            }
+            std::size_t parts = (threads == 1) ? 1 : detail::chunk_count(total, threads);
+            Run merged;
+            try {
+                merged = (parts > 1) ? merge_runs_parallel(runs, total, comp, parts) : merge_runs(runs, comp);
+            } catch (...) {
+                for (DoublyLinkedList& list : lists) {
+                    if (list.header != nullptr) {
+                        list.pool.adopt(out.pool);
+                        for (const Run& run : runs) {
+                            list.append_run(run);
+                        }
+                        break;
+                    }
+                }
+                throw;
+            }
+            out.append_run(merged);
+            return out;
+        }
+
         // non-member function to swap two lists
         friend void swap(DoublyLinkedList& a, DoublyLinkedList& b) {
             using std::swap;
             swap(a.header, b.header);
             swap(a.trailer, b.trailer);
             swap(a.sz, b.sz);
+            swap(a.order, b.order);
+            swap(a.pool, b.pool);
+            swap(a.compaction, b.compaction);
         }
         
         // resets the list to empty
@@ -300,16 +1427,18 @@ class DoublyLinkedList {
         }
 
 
+        // Copy-assigns into the nodes we already have and only allocates or
+        // frees the difference in size. A moved-from list can be assigned to.
         DoublyLinkedList& operator=(const DoublyLinkedList& other) {
-             if (this != &other) {
-                clear();
-                clone(other);
+            if (this != &other) {
+                assign_from(other);
             }
             return *this;
         }
 
         DoublyLinkedList(DoublyLinkedList&& other) 
-           : header(other.header), trailer(other.trailer), sz(other.sz) 
+           : header(other.header), trailer(other.trailer), sz(other.sz), order(std::move(other.order)),
+             pool(std::move(other.pool)), compaction(std::move(other.compaction))
            {
                 other.header = nullptr;
                 other.trailer = nullptr;
@@ -326,6 +1455,10 @@ class DoublyLinkedList {
                 header = other.header;
                 trailer = other.trailer;
                 sz = other.sz;
+                order = std::move(other.order);
+                compaction.reset();   // its slab went with our nodes
+                compaction = std::move(other.compaction);
+                pool = std::move(other.pool);
 
                 //nulll original others
                 other.header = nullptr;
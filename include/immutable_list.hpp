@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>     // provides std::swap, std::exchange
+#include <vector>
+
+namespace dsa::list {
+
+// Persistent singly linked (cons) list.
+// A list never changes once built: push_front and pop_front return a new list
+// that shares its tail with the old one, so both, and copying, are O(1) and
+// every earlier version stays valid. Nodes are reference counted (atomically,
+// so versions may be shared across threads) and freed with the last list
+// that reaches them.
+template <typename T>
+class ImmutableList {
+    private:
+        class Node {
+            public:
+                T elem;
+                const Node* next;
+                mutable std::atomic<std::size_t> refs{1};
+
+                Node(const T& element, const Node* nxt)
+                : elem{element}, next{nxt} {}
+        };
+
+        const Node* head{nullptr};
+        std::size_t sz{0};
+
+        static void retain(const Node* node) {
+            if (node != nullptr) {
+                node->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // drops one reference, freeing the chain as far as nobody else shares it;
+        // a loop rather than recursion so long lists can't overflow the stack
+        static void release(const Node* node) {
+            while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                const Node* next = node->next;
+                delete node;
+                node = next;
+            }
+        }
+
+        // takes ownership of one reference to node
+        ImmutableList(const Node* node, std::size_t size) : head{node}, sz{size} {}
+
+    public:
+        // Constructs an empty list
+        ImmutableList() = default;
+
+        // Builds a list holding [first, last) in order, e.g. from a SinglyLinkedList
+        template <typename InputIt>
+        ImmutableList(InputIt first, InputIt last) {
+            std::vector<T> items;
+            for (; first != last; ++first) {
+                items.push_back(*first);
+            }
+            for (auto it = items.rbegin(); it != items.rend(); ++it) {
+                head = new Node(*it, head);
+                sz++;
+            }
+        }
+
+        ImmutableList(const ImmutableList& other) : head{other.head}, sz{other.sz} {
+            retain(head);
+        }
+
+        ImmutableList& operator=(const ImmutableList& other) {
+            if (this != &other) {
+                retain(other.head);
+                release(head);
+                head = other.head;
+                sz = other.sz;
+            }
+            return *this;
+        }
+
+        ImmutableList(ImmutableList&& other) noexcept
+        : head{std::exchange(other.head, nullptr)}, sz{std::exchange(other.sz, 0)} {}
+
+        ImmutableList& operator=(ImmutableList&& other) noexcept {
+            if (this != &other) {
+                release(head);
+                head = std::exchange(other.head, nullptr);
+                sz = std::exchange(other.sz, 0);
+            }
+            return *this;
+        }
+
+        ~ImmutableList() {
+            release(head);
+        }
+
+        friend void swap(ImmutableList& a, ImmutableList& b) noexcept {
+            using std::swap;
+            swap(a.head, b.head);
+            swap(a.sz, b.sz);
+        }
+
+        std::size_t size() const {
+            return sz;
+        }
+
+        bool empty() const {
+            return sz == 0;
+        }
+
+        const T& front() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return head->elem;
+        }
+
+        // New version with elem in front of this one
+        ImmutableList push_front(const T& elem) const {
+            const Node* node = new Node(elem, head);
+            retain(head);
+            return ImmutableList(node, sz + 1);
+        }
+
+        // New version without the first element; empty if this one is empty
+        ImmutableList pop_front() const {
+            if (empty()) {
+                return ImmutableList();
+            }
+            retain(head->next);
+            return ImmutableList(head->next, sz - 1);
+        }
+
+        // true if both lists are the same version (share every node)
+        bool same(const ImmutableList& other) const {
+            return head == other.head;
+        }
+
+        class const_iterator {
+            private:
+                const Node* node_ptr;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                const_iterator(const Node* ptr = nullptr)
+                : node_ptr(ptr) {}
+
+                const T& operator*() const {
+                    return node_ptr->elem;
+                }
+                const T* operator->() const {
+                    return &(node_ptr->elem);
+                }
+                const_iterator& operator++() {
+                    node_ptr = node_ptr->next;
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                bool operator==(const_iterator rhs) const {
+                    return node_ptr == rhs.node_ptr;
+                }
+                bool operator!=(const_iterator rhs) const {
+                    return node_ptr != rhs.node_ptr;
+                }
+        };
+        using iterator = const_iterator;
+
+        const_iterator begin() const {
+            return const_iterator(head);
+        }
+
+        const_iterator end() const {
+            return const_iterator(nullptr);
+        }
+};
+
+}  // namespace dsa::list
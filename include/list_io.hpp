@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>     // provides std::memcpy, std::memcmp
+#include <istream>
+#include <new>         // provides std::launder
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>  // provides ::fstat
+#include <unistd.h>    // provides ::read, ::write, ::lseek
+#define DSA_LIST_HAS_FD_IO 1
+#endif
+
+namespace dsa::list::io {
+
+// Binary list format shared by the list save()/load() members:
+// a fixed header followed by all elements back to back, in list order.
+// Only trivially copyable element types are supported; the bytes are written
+// as they are in memory, so files are not portable across endianness or ABIs.
+struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t elem_size;
+    std::uint32_t elem_align;
+    std::uint64_t count;
+};
+
+inline constexpr char magic[4] = {'D', 'S', 'A', 'L'};
+inline constexpr std::uint32_t version = 1;
+
+// elements are staged through a buffer of this size
+inline constexpr std::size_t chunk_bytes = std::size_t{1} << 16;
+
+class StreamSink {
+    private:
+        std::ostream& out;
+
+    public:
+        explicit StreamSink(std::ostream& os) : out{os} {}
+
+        void write(const void* data, std::size_t n) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(n));
+            if (!out) {
+                throw std::runtime_error("List save failed");
+            }
+        }
+};
+
+class StreamSource {
+    private:
+        std::istream& in;
+
+    public:
+        explicit StreamSource(std::istream& is) : in{is} {}
+
+        void read(void* data, std::size_t n) {
+            in.read(static_cast<char*>(data), static_cast<std::streamsize>(n));
+            if (static_cast<std::size_t>(in.gcount()) != n) {
+                throw std::runtime_error("List load failed: unexpected end of input");
+            }
+        }
+
+        // bytes left in the stream, if it can seek
+        std::optional<std::uint64_t> remaining() {
+            std::istream::pos_type here = in.tellg();
+            if (here == std::istream::pos_type(-1)) {
+                return std::nullopt;
+            }
+            in.seekg(0, std::ios::end);
+            std::istream::pos_type end = in.tellg();
+            in.seekg(here);
+            if (!in || end == std::istream::pos_type(-1)) {
+                in.clear();
+                return std::nullopt;
+            }
+            return end > here ? static_cast<std::uint64_t>(end - here) : 0;
+        }
+};
+
+#ifdef DSA_LIST_HAS_FD_IO
+class FdSink {
+    private:
+        int fd;
+
+    public:
+        explicit FdSink(int file) : fd{file} {}
+
+        void write(const void* data, std::size_t n) {
+            const char* p = static_cast<const char*>(data);
+            while (n > 0) {
+                ssize_t done = ::write(fd, p, n);
+                if (done < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error("List save failed");
+                }
+                p += done;
+                n -= static_cast<std::size_t>(done);
+            }
+        }
+};
+
+class FdSource {
+    private:
+        int fd;
+
+    public:
+        explicit FdSource(int file) : fd{file} {}
+
+        void read(void* data, std::size_t n) {
+            char* p = static_cast<char*>(data);
+            while (n > 0) {
+                ssize_t done = ::read(fd, p, n);
+                if (done < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (done <= 0) {
+                    throw std::runtime_error("List load failed: unexpected end of input");
+                }
+                p += done;
+                n -= static_cast<std::size_t>(done);
+            }
+        }
+
+        // bytes left in the file, if fd is a regular file
+        std::optional<std::uint64_t> remaining() {
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+                return std::nullopt;
+            }
+            off_t here = ::lseek(fd, 0, SEEK_CUR);
+            if (here < 0) {
+                return std::nullopt;
+            }
+            return st.st_size > here ? static_cast<std::uint64_t>(st.st_size - here) : 0;
+        }
+};
+#endif
+
+// Writes the header and count elements; visit(f) must call f(elem) for each
+// element in list order.
+template <typename T, typename Sink, typename Visit>
+void write_list(Sink& sink, std::uint64_t count, Visit visit) {
+    static_assert(std::is_trivially_copyable_v<T>, "binary list I/O needs a trivially copyable T");
+    Header h{};
+    std::memcpy(h.magic, magic, sizeof magic);
+    h.version = version;
+    h.elem_size = sizeof(T);
+    h.elem_align = alignof(T);
+    h.count = count;
+    sink.write(&h, sizeof h);
+
+    const std::size_t per_chunk = chunk_bytes / sizeof(T) + 1;
+    std::vector<unsigned char> buffer(per_chunk * sizeof(T));
+    std::size_t used = 0;
+    visit([&](const T& elem) {
+        std::memcpy(buffer.data() + used * sizeof(T), &elem, sizeof(T));
+        if (++used == per_chunk) {
+            sink.write(buffer.data(), used * sizeof(T));
+            used = 0;
+        }
+    });
+    if (used > 0) {
+        sink.write(buffer.data(), used * sizeof(T));
+    }
+}
+
+// Reads and checks the header, returning the element count
+template <typename T, typename Source>
+std::uint64_t read_header(Source& source) {
+    Header h;
+    source.read(&h, sizeof h);
+    if (std::memcmp(h.magic, magic, sizeof magic) != 0 || h.version != version) {
+        throw std::runtime_error("List load failed: not a list file");
+    }
+    if (h.elem_size != sizeof(T) || h.elem_align != alignof(T)) {
+        throw std::runtime_error("List load failed: element type mismatch");
+    }
+    return h.count;
+}
+
+// How many of count elements a loader may allocate before reading any: all of
+// them when the source knows how many bytes it has left (a count those bytes
+// can't hold is rejected), otherwise one chunk's worth, so a corrupt count
+// runs into the end of the input instead of a huge allocation.
+template <typename T, typename Source>
+std::uint64_t first_batch(Source& source, std::uint64_t count) {
+    if (std::optional<std::uint64_t> left = source.remaining()) {
+        if (count > *left / sizeof(T)) {
+            throw std::runtime_error("List load failed: unexpected end of input");
+        }
+        return count;
+    }
+    const std::uint64_t per_chunk = chunk_bytes / sizeof(T) + 1;
+    return count < per_chunk ? count : per_chunk;
+}
+
+// Reads count elements, calling emit(elem) for each in order
+template <typename T, typename Source, typename Emit>
+void read_elements(Source& source, std::uint64_t count, Emit emit) {
+    static_assert(std::is_trivially_copyable_v<T>, "binary list I/O needs a trivially copyable T");
+    const std::size_t per_chunk = chunk_bytes / sizeof(T) + 1;
+    std::vector<unsigned char> buffer(per_chunk * sizeof(T));
+    while (count > 0) {
+        std::size_t n = count < per_chunk ? static_cast<std::size_t>(count) : per_chunk;
+        source.read(buffer.data(), n * sizeof(T));
+        for (std::size_t i = 0; i < n; ++i) {
+            alignas(T) unsigned char raw[sizeof(T)];
+            std::memcpy(raw, buffer.data() + i * sizeof(T), sizeof(T));
+            emit(*std::launder(reinterpret_cast<const T*>(raw)));
+        }
+        count -= n;
+    }
+}
+
+}  // namespace dsa::list::io
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // provides std::hash, std::equal_to
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>     // provides std::pair, std::move
+
+#include "doubly_linked.hpp"
+
+namespace dsa::cache {
+
+// Least-recently-used cache on a DoublyLinkedList recency list.
+// The list runs from most to least recently used; a hash map finds an entry's
+// node. Hits splice the node to the front and, once the cache is full, a miss
+// reuses the evicted back node and its map node for the new key, so a steady
+// state miss allocates and frees nothing.
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class LruCache {
+    public:
+        struct Stats {
+            std::uint64_t hits{0};
+            std::uint64_t misses{0};
+            std::uint64_t evictions{0};
+        };
+
+    private:
+        using Entry = std::pair<K, V>;
+        using List = dsa::list::DoublyLinkedList<Entry>;
+        using Position = typename List::iterator;
+
+        std::size_t cap;
+        List entries;   // front is the most recently used
+        std::unordered_map<K, Position, Hash, KeyEqual> where;
+        Stats counters;
+
+        void promote(Position it) {
+            entries.splice(entries.begin(), entries, it);
+        }
+
+        // swaps contents with other, an empty cache with no counts
+        void take(LruCache& other) {
+            using std::swap;
+            swap(entries, other.entries);
+            where.swap(other.where);
+            swap(counters, other.counters);
+        }
+
+        // points where at entries' nodes
+        void index_entries() {
+            where.clear();
+            where.reserve(cap);
+            for (Position it = entries.begin(); it != entries.end(); ++it) {
+                where.emplace(it->first, it);
+            }
+        }
+
+    public:
+        // Constructs an empty cache holding at most capacity entries
+        explicit LruCache(std::size_t capacity) : cap{capacity} {
+            if (capacity == 0) {
+                throw std::invalid_argument("Cache capacity must be positive");
+            }
+            where.reserve(capacity);
+        }
+
+        // copies hold their own entries, so the map is rebuilt to point at them
+        LruCache(const LruCache& other) : cap{other.cap}, entries(other.entries), counters{other.counters} {
+            index_entries();
+        }
+
+        LruCache& operator=(const LruCache& other) {
+            if (this != &other) {
+                LruCache copy(other);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        // List nodes don't move with the list, so the map's positions stay
+        // valid. other is left an empty cache with the same capacity.
+        LruCache(LruCache&& other) : cap{other.cap} {
+            take(other);
+        }
+
+        LruCache& operator=(LruCache&& other) {
+            if (this != &other) {
+                cap = other.cap;
+                clear();
+                reset_stats();
+                take(other);
+            }
+            return *this;
+        }
+
+        std::size_t size() const {
+            return where.size();
+        }
+
+        std::size_t capacity() const {
+            return cap;
+        }
+
+        bool empty() const {
+            return where.empty();
+        }
+
+        bool contains(const K& key) const {
+            return where.find(key) != where.end();
+        }
+
+        // Looks up key, counting a hit or miss and making it the most recently
+        // used. The pointer stays valid until the entry is evicted or erased.
+        V* get(const K& key) {
+            auto found = where.find(key);
+            if (found == where.end()) {
+                counters.misses++;
+                return nullptr;
+            }
+            counters.hits++;
+            promote(found->second);
+            return &found->second->second;
+        }
+
+        // Looks up key without counting or changing its recency
+        const V* peek(const K& key) const {
+            auto found = where.find(key);
+            return found == where.end() ? nullptr : &found->second->second;
+        }
+
+        // Makes key the most recently used, if present, without counting
+        bool touch(const K& key) {
+            auto found = where.find(key);
+            if (found == where.end()) {
+                return false;
+            }
+            promote(found->second);
+            return true;
+        }
+
+        // Inserts or updates key as the most recently used entry, evicting the
+        // least recently used one if the cache is full
+        void put(const K& key, const V& value) {
+            auto found = where.find(key);
+            if (found != where.end()) {
+                found->second->second = value;
+                promote(found->second);
+                return;
+            }
+            if (where.size() < cap) {
+                entries.push_front(Entry{key, value});
+                try {
+                    where.emplace(key, entries.begin());
+                } catch (...) {
+                    entries.pop_front();
+                    throw;
+                }
+                return;
+            }
+
+            // recycle the least recently used node and its map node
+            Position victim = --entries.end();
+            auto handle = where.extract(victim->first);
+            try {
+                handle.key() = key;
+                victim->first = key;
+                victim->second = value;
+                where.insert(std::move(handle));
+            } catch (...) {
+                // the victim is half overwritten and its map node is gone with
+                // handle, so it is evicted without a replacement
+                entries.erase(victim);
+                counters.evictions++;
+                throw;
+            }
+            promote(victim);
+            counters.evictions++;
+        }
+
+        // Removes key; returns false if it wasn't cached
+        bool erase(const K& key) {
+            auto found = where.find(key);
+            if (found == where.end()) {
+                return false;
+            }
+            entries.erase(found->second);
+            where.erase(found);
+            return true;
+        }
+
+        void clear() {
+            entries.clear();
+            where.clear();
+        }
+
+        const Stats& stats() const {
+            return counters;
+        }
+
+        void reset_stats() {
+            counters = Stats{};
+        }
+};
+
+}  // namespace dsa::cache
@@ -0,0 +1,455 @@
+#pragma once
+
+// Linux only: relies on mmap/mremap/msync.
+
+#include <atomic>      // provides std::atomic_thread_fence
+#include <cerrno>
+#include <cstdint>
+#include <cstring>     // provides std::memcpy, std::memcmp
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>     // provides std::swap, std::exchange
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dsa::list {
+
+// Doubly linked list whose nodes live in a memory-mapped file.
+// Links are byte offsets into the file instead of pointers, so the file can be
+// mapped at any address: reopening it is instant (no deserialization) and other
+// processes can open it read-only while it is in use.
+// Changes reach the file through the shared mapping; sync() waits until the
+// pages written so far are on disk. Nothing is atomic, though: a crash, or a
+// reader looking while the writer works, can catch an update half done. The
+// writer fills in a node before linking it and updates the size last, so a
+// reader following links finds complete nodes, but the size may not yet
+// match them. T must be trivially copyable.
+template <typename T>
+class MappedDoublyLinkedList {
+    static_assert(std::is_trivially_copyable_v<T>, "mapped lists need a trivially copyable T");
+
+    public:
+        enum class Mode { read_write, read_only };
+
+    private:
+        using Offset = std::uint64_t;   // 0 means no node
+
+        struct Node {
+            Offset prev;
+            Offset next;
+            T elem;
+        };
+
+        struct FileHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t elem_size;
+            std::uint32_t elem_align;
+            std::uint32_t node_size;
+            std::uint64_t size;        // number of elements
+            Offset used;               // end of the allocated node area
+            Offset free_head;          // first recycled node, linked through next
+            Offset header;             // front sentinel
+            Offset trailer;            // back sentinel
+        };
+
+        static constexpr char magic[8] = {'D', 'S', 'A', 'M', 'A', 'P', 'L', '\0'};
+        static constexpr std::uint32_t version = 1;
+        static constexpr Offset initial_bytes = 4096;
+
+        static constexpr Offset align_up(Offset n, Offset a) {
+            return (n + a - 1) / a * a;
+        }
+        static constexpr Offset first_node = align_up(sizeof(FileHeader), alignof(Node));
+
+        int fd{-1};
+        char* base{nullptr};
+        std::size_t mapped{0};
+        Mode mode{Mode::read_write};
+
+        [[noreturn]] static void fail(const char* what) {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        FileHeader& meta() const {
+            return *reinterpret_cast<FileHeader*>(base);
+        }
+
+        // true if off can start a node inside the first `limit` bytes
+        static bool node_fits(Offset off, Offset limit) {
+            return off >= first_node && (off - first_node) % sizeof(Node) == 0
+                   && off <= limit && limit - off >= sizeof(Node);
+        }
+
+        Node& node(Offset off) const {
+            // a reader's mapping doesn't follow the writer's growth, a link it
+            // reads may be torn, and a writer may open a damaged file; in every
+            // case, don't touch bytes outside the mapping
+            if (!node_fits(off, mapped)) {
+                throw std::runtime_error(mode == Mode::read_only
+                    ? "Mapped list link outside the mapping; refresh() and retry"
+                    : "Mapped list link outside the mapping; the file is corrupt");
+            }
+            return *reinterpret_cast<Node*>(base + off);
+        }
+
+        void map(std::size_t bytes) {
+            int prot = (mode == Mode::read_only) ? PROT_READ : PROT_READ | PROT_WRITE;
+            void* p = ::mmap(nullptr, bytes, prot, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                fail("mmap");
+            }
+            base = static_cast<char*>(p);
+            mapped = bytes;
+        }
+
+        // grows the file (and the mapping) to at least bytes
+        void grow(std::size_t bytes) {
+            std::size_t want = mapped;
+            while (want < bytes) {
+                want *= 2;
+            }
+            if (::ftruncate(fd, static_cast<off_t>(want)) != 0) {
+                fail("ftruncate");
+            }
+            void* p = ::mremap(base, mapped, want, MREMAP_MAYMOVE);
+            if (p == MAP_FAILED) {
+                fail("mremap");
+            }
+            base = static_cast<char*>(p);
+            mapped = want;
+        }
+
+        void require_writable() const {
+            if (mode == Mode::read_only) {
+                throw std::logic_error("List is open read-only");
+            }
+        }
+
+        Offset allocate_node() {
+            FileHeader& h = meta();
+            if (h.free_head != 0) {
+                Offset off = h.free_head;
+                h.free_head = node(off).next;
+                return off;
+            }
+            Offset off = h.used;
+            if (off + sizeof(Node) > mapped) {
+                grow(off + sizeof(Node));
+            }
+            meta().used = off + sizeof(Node);
+            return off;
+        }
+
+        void free_node(Offset off) {
+            node(off).next = meta().free_head;
+            meta().free_head = off;
+        }
+
+        void format() {
+            if (::ftruncate(fd, static_cast<off_t>(initial_bytes)) != 0) {
+                fail("ftruncate");
+            }
+            map(initial_bytes);
+            FileHeader& h = meta();
+            std::memcpy(h.magic, magic, sizeof magic);
+            h.version = version;
+            h.elem_size = sizeof(T);
+            h.elem_align = alignof(T);
+            h.node_size = sizeof(Node);
+            h.size = 0;
+            h.used = first_node;
+            h.free_head = 0;
+            Offset front = allocate_node();
+            Offset back = allocate_node();
+            meta().header = front;
+            meta().trailer = back;
+            // the new file area is zero-filled, so only the links need setting
+            node(front).prev = 0;
+            node(front).next = back;
+            node(back).prev = front;
+            node(back).next = 0;
+        }
+
+        void validate() const {
+            const FileHeader& h = meta();
+            if (std::memcmp(h.magic, magic, sizeof magic) != 0 || h.version != version) {
+                throw std::runtime_error("Not a mapped list file");
+            }
+            if (h.elem_size != sizeof(T) || h.elem_align != alignof(T) || h.node_size != sizeof(Node)) {
+                throw std::runtime_error("Mapped list element type mismatch");
+            }
+            if (h.used > mapped) {
+                throw std::runtime_error("Mapped list file is truncated");
+            }
+            if (h.used < first_node || (h.used - first_node) % sizeof(Node) != 0) {
+                throw std::runtime_error("Mapped list file is corrupt");
+            }
+            if (!node_fits(h.header, h.used) || !node_fits(h.trailer, h.used) || h.header == h.trailer
+                || (h.free_head != 0 && !node_fits(h.free_head, h.used))) {
+                throw std::runtime_error("Mapped list file is corrupt");
+            }
+            if (h.size > (h.used - first_node) / sizeof(Node) - 2) {
+                throw std::runtime_error("Mapped list file is corrupt");
+            }
+        }
+
+        Offset insert_before(const T& elem, Offset successor) {
+            require_writable();
+            Offset off = allocate_node();   // may remap, so no references are held across it
+            Offset before = node(successor).prev;
+            node(off) = Node{before, successor, elem};
+            std::atomic_thread_fence(std::memory_order_release);   // complete before it is linked
+            node(before).next = off;
+            node(successor).prev = off;
+            meta().size++;
+            return off;
+        }
+
+        void erase(Offset off) {
+            require_writable();
+            if (off == meta().header || off == meta().trailer) {
+                throw std::runtime_error("Cant erase nodes");
+            }
+            Node& n = node(off);
+            node(n.prev).next = n.next;
+            node(n.next).prev = n.prev;
+            free_node(off);
+            meta().size--;
+        }
+
+        void close() {
+            if (base != nullptr) {
+                ::munmap(base, mapped);
+                base = nullptr;
+            }
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+    public:
+        // Opens the list stored at path. In read_write mode a missing or empty
+        // file is created as an empty list; an existing file is used as it is.
+        explicit MappedDoublyLinkedList(const std::string& path, Mode m = Mode::read_write) : mode{m} {
+            int flags = (mode == Mode::read_only) ? O_RDONLY : O_RDWR | O_CREAT;
+            fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+            if (fd < 0) {
+                fail("open");
+            }
+            try {
+                struct stat st;
+                if (::fstat(fd, &st) != 0) {
+                    fail("fstat");
+                }
+                if (st.st_size == 0 && mode == Mode::read_write) {
+                    format();
+                } else {
+                    if (static_cast<std::size_t>(st.st_size) < sizeof(FileHeader)) {
+                        throw std::runtime_error("Not a mapped list file");
+                    }
+                    map(static_cast<std::size_t>(st.st_size));
+                    validate();
+                }
+            } catch (...) {
+                close();
+                throw;
+            }
+        }
+
+        MappedDoublyLinkedList(const MappedDoublyLinkedList&) = delete;
+        MappedDoublyLinkedList& operator=(const MappedDoublyLinkedList&) = delete;
+
+        MappedDoublyLinkedList(MappedDoublyLinkedList&& other) noexcept
+        : fd{std::exchange(other.fd, -1)}, base{std::exchange(other.base, nullptr)},
+          mapped{std::exchange(other.mapped, 0)}, mode{other.mode} {}
+
+        MappedDoublyLinkedList& operator=(MappedDoublyLinkedList&& other) noexcept {
+            if (this != &other) {
+                close();
+                fd = std::exchange(other.fd, -1);
+                base = std::exchange(other.base, nullptr);
+                mapped = std::exchange(other.mapped, 0);
+                mode = other.mode;
+            }
+            return *this;
+        }
+
+        // unmaps without syncing; changes already written reach the file regardless
+        ~MappedDoublyLinkedList() {
+            close();
+        }
+
+        // Returns once all changes so far are on disk. It is a flush, not a
+        // commit: a crash before it returns may leave any of them half written.
+        void sync() {
+            if (::msync(base, mapped, MS_SYNC) != 0) {
+                fail("msync");
+            }
+        }
+
+        // For read-only views: maps any growth made by a writer since opening.
+        // A reader that meets a link past its mapping throws std::runtime_error
+        // instead; its iterators stay valid across refresh().
+        void refresh() {
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+                fail("fstat");
+            }
+            std::size_t bytes = static_cast<std::size_t>(st.st_size);
+            if (bytes > mapped) {
+                void* p = ::mremap(base, mapped, bytes, MREMAP_MAYMOVE);
+                if (p == MAP_FAILED) {
+                    fail("mremap");
+                }
+                base = static_cast<char*>(p);
+                mapped = bytes;
+            }
+            validate();
+        }
+
+        std::size_t size() const {
+            return meta().size;
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        const T& front() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return node(node(meta().header).next).elem;
+        }
+
+        const T& back() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return node(node(meta().trailer).prev).elem;
+        }
+
+        void push_front(const T& elem) {
+            insert_before(elem, node(meta().header).next);
+        }
+
+        void push_back(const T& elem) {
+            insert_before(elem, meta().trailer);
+        }
+
+        void pop_front() {
+            if (empty())
+                return;
+            erase(node(meta().header).next);
+        }
+
+        void pop_back() {
+            if (empty())
+                return;
+            erase(node(meta().trailer).prev);
+        }
+
+        void clear() {
+            while (!empty()) {
+                pop_front();
+            }
+        }
+
+        // Iterators hold offsets, so they stay valid when the file grows and is remapped.
+        // Elements are read-only through them; use insert/erase to change the list.
+        class const_iterator {
+            friend class MappedDoublyLinkedList;
+
+            private:
+                const MappedDoublyLinkedList* list{nullptr};
+                Offset off{0};
+
+                const_iterator(const MappedDoublyLinkedList* l, Offset o) : list(l), off(o) {}
+
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                const_iterator() = default;
+
+                const T& operator*() const {
+                    return list->node(off).elem;
+                }
+                const T* operator->() const {
+                    return &list->node(off).elem;
+                }
+                const_iterator& operator++() {
+                    off = list->node(off).next;
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                const_iterator& operator--() {
+                    off = list->node(off).prev;
+                    return *this;
+                }
+                const_iterator operator--(int) {
+                    const_iterator old = *this;
+                    --(*this);
+                    return old;
+                }
+                bool operator==(const const_iterator& other) const {
+                    return off == other.off;
+                }
+                bool operator!=(const const_iterator& other) const {
+                    return off != other.off;
+                }
+        };
+        using iterator = const_iterator;
+
+        const_iterator begin() const {
+            return const_iterator(this, node(meta().header).next);
+        }
+
+        const_iterator end() const {
+            return const_iterator(this, meta().trailer);
+        }
+
+        iterator insert(const_iterator it, const T& elem) {
+            return iterator(this, insert_before(elem, it.off));
+        }
+
+        iterator erase(const_iterator it) {
+            if (it.off == meta().trailer || it.off == meta().header) {
+                throw std::runtime_error("Cant erase end() iterator");
+            }
+            Offset successor = node(it.off).next;
+            erase(it.off);
+            return iterator(this, successor);
+        }
+
+        // Overwrites the element at it in place
+        void assign(const_iterator it, const T& elem) {
+            require_writable();
+            node(it.off).elem = elem;
+        }
+
+        friend void swap(MappedDoublyLinkedList& a, MappedDoublyLinkedList& b) noexcept {
+            using std::swap;
+            swap(a.fd, b.fd);
+            swap(a.base, b.base);
+            swap(a.mapped, b.mapped);
+            swap(a.mode, b.mode);
+        }
+};
+
+}  // namespace dsa::list
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>     // provides std::exchange
+
+namespace dsa::list::layout {
+
+// Node layout policies for the list templates.
+// A policy decides how a node holds its element (payload<T>, reached through
+// get()) and how the node itself is aligned (node_alignment). Links always
+// come first in the node, so a traversal that doesn't read elements only
+// touches the start of each node.
+
+// The element is stored in the node, right after the links (the default)
+struct inline_payload {
+    static constexpr std::size_t node_alignment = alignof(void*);
+
+    template <typename T>
+    class payload {
+        private:
+            T value;
+
+        public:
+            payload() = default;
+            explicit payload(const T& v) : value{v} {}
+
+            T& get() { return value; }
+            const T& get() const { return value; }
+    };
+};
+
+// As inline_payload, but every node starts on its own cache line, so a node's
+// links never straddle two lines and neighbouring nodes never share one
+struct cache_aligned {
+    static constexpr std::size_t node_alignment = 64;   // cache line size on common hardware
+
+    template <typename T>
+    using payload = inline_payload::payload<T>;
+};
+
+// The node holds its links and a pointer to a separately allocated element.
+// Nodes stay small and dense whatever the size of T, so walking the links
+// pulls no element bytes into cache; reading an element costs one more hop.
+// Sentinel nodes (default constructed) allocate no element.
+struct out_of_line {
+    static constexpr std::size_t node_alignment = alignof(void*);
+
+    template <typename T>
+    class payload {
+        private:
+            T* value{nullptr};
+
+        public:
+            payload() = default;
+            explicit payload(const T& v) : value{new T(v)} {}
+
+            // nodes are never copied; elements are copied through get()
+            payload(const payload&) = delete;
+            payload& operator=(const payload&) = delete;
+
+            // relocating a node hands the element over without touching it
+            payload(payload&& other) noexcept : value{std::exchange(other.value, nullptr)} {}
+
+            ~payload() {
+                delete value;
+            }
+
+            T& get() { return *value; }
+            const T& get() const { return *value; }
+    };
+};
+
+}  // namespace dsa::list::layout
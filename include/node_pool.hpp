@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>   // provides std::find, std::sort, std::upper_bound
+#include <cstddef>
+#include <functional>  // provides std::less, std::less_equal
+#include <limits>
+#include <memory>      // provides std::shared_ptr, std::construct_at
+#include <new>         // provides std::align_val_t, std::bad_array_new_length
+#include <utility>     // provides std::swap, std::exchange, std::pair
+#include <vector>
+
+namespace dsa::list {
+
+// Node storage used by the lists.
+// Single nodes come from the heap. bulk() hands out a slab: one contiguous
+// allocation holding many nodes. A node that lives in a slab is never freed on
+// its own; destroy() keeps its slot on the pool's free list for the next create().
+// Slabs are reference counted, so when nodes move to another list (concatenate,
+// split) the receiving pool adopts the slabs and they live until neither pool
+// refers to them.
+template <typename Node>
+class NodePool {
+    private:
+        static constexpr std::align_val_t alignment{alignof(Node)};
+
+        class Slab {
+            public:
+                Node* data;
+                std::size_t capacity;
+
+                explicit Slab(std::size_t n)
+                : data{static_cast<Node*>(::operator new(n * sizeof(Node), alignment))}, capacity{n} {}
+                Slab(const Slab&) = delete;
+                Slab& operator=(const Slab&) = delete;
+                ~Slab() { ::operator delete(data, alignment); }
+
+                bool contains(const void* p) const {
+                    const void* first = data;
+                    const void* last = data + capacity;
+                    return std::less_equal<const void*>{}(first, p) && std::less<const void*>{}(p, last);
+                }
+        };
+
+        // a released slab slot, linked through its own storage
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+
+        std::vector<std::shared_ptr<Slab>> slabs;
+        FreeSlot* free_slots{nullptr};
+
+        bool in_slab(const void* p) const {
+            return find_slab(p) != nullptr;
+        }
+
+        const Slab* find_slab(const void* p) const {
+            for (const auto& slab : slabs) {
+                if (slab->contains(p)) {
+                    return slab.get();
+                }
+            }
+            return nullptr;
+        }
+
+    public:
+        NodePool() = default;
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        NodePool(NodePool&& other) noexcept
+        : slabs(std::move(other.slabs)), free_slots(std::exchange(other.free_slots, nullptr)) {
+            other.slabs.clear();
+        }
+
+        NodePool& operator=(NodePool&& other) noexcept {
+            if (this != &other) {
+                slabs = std::move(other.slabs);
+                other.slabs.clear();
+                free_slots = std::exchange(other.free_slots, nullptr);
+            }
+            return *this;
+        }
+
+        // free slots live inside the slabs, so there is nothing else to release
+        ~NodePool() = default;
+
+        friend void swap(NodePool& a, NodePool& b) noexcept {
+            using std::swap;
+            swap(a.slabs, b.slabs);
+            swap(a.free_slots, b.free_slots);
+        }
+
+        // uninitialized storage for one node
+        Node* allocate() {
+            if (free_slots != nullptr) {
+                FreeSlot* slot = free_slots;
+                free_slots = slot->next;
+                return reinterpret_cast<Node*>(slot);
+            }
+            return static_cast<Node*>(::operator new(sizeof(Node), alignment));
+        }
+
+        // returns storage whose node has already been destroyed (or never built)
+        void deallocate(Node* p) {
+            if (!slabs.empty() && in_slab(p)) {
+                free_slots = ::new (static_cast<void*>(p)) FreeSlot{free_slots};
+            } else {
+                ::operator delete(p, alignment);
+            }
+        }
+
+        template <typename... Args>
+        Node* create(Args&&... args) {
+            Node* p = allocate();
+            try {
+                return std::construct_at(p, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(p);
+                throw;
+            }
+        }
+
+        void destroy(Node* p) {
+            std::destroy_at(p);
+            deallocate(p);
+        }
+
+        // Destroys a chain of unlinked nodes, from first along next to nullptr.
+        // Neighbouring nodes usually share a slab, so the slab found for one
+        // is tried first for the next, and the freed slots join the free list
+        // in one splice.
+        void destroy_chain(Node* first) {
+            FreeSlot* chain = nullptr;
+            FreeSlot* chain_last = nullptr;
+            const Slab* hint = nullptr;
+            while (first != nullptr) {
+                Node* next = first->next;
+                std::destroy_at(first);
+                if (hint == nullptr || !hint->contains(first)) {
+                    hint = slabs.empty() ? nullptr : find_slab(first);
+                }
+                if (hint != nullptr) {
+                    chain = ::new (static_cast<void*>(first)) FreeSlot{chain};
+                    if (chain_last == nullptr) {
+                        chain_last = chain;
+                    }
+                } else {
+                    ::operator delete(first, alignment);
+                }
+                first = next;
+            }
+            if (chain_last != nullptr) {
+                chain_last->next = free_slots;
+                free_slots = chain;
+            }
+        }
+
+        // Uninitialized, contiguous storage for n nodes, owned by this pool.
+        // Slots the caller doesn't construct may be handed back through deallocate().
+        // Throws std::bad_array_new_length if n nodes can't fit in the address space.
+        Node* bulk(std::size_t n) {
+            if (n == 0) {
+                return nullptr;
+            }
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(Node)) {
+                throw std::bad_array_new_length();
+            }
+            slabs.push_back(std::make_shared<Slab>(n));
+            return slabs.back()->data;
+        }
+
+        // Slots for up to total nodes built one after another, when not all of
+        // them may turn up: slabs start at first nodes and then double, so the
+        // storage taken stays within twice what was actually built.
+        class Feed {
+            private:
+                NodePool& pool;
+                std::size_t total;
+                std::size_t batch;
+                Node* slots{nullptr};
+                std::size_t left{0};
+
+            public:
+                Feed(NodePool& p, std::size_t total_nodes, std::size_t first)
+                : pool{p}, total{total_nodes}, batch{first} {}
+
+                Node* next() {
+                    if (left == 0) {
+                        left = batch < total ? batch : total;
+                        slots = pool.bulk(left);
+                        batch = left * 2;
+                    }
+                    --left;
+                    --total;
+                    return slots++;
+                }
+        };
+
+        // Drops every slab whose slots are all on the free list, taking those
+        // slots off it. Slots can only be free in one pool, so such a slab holds
+        // no live node of any list. O(free slots * log slabs).
+        void release_empty_slabs() {
+            if (slabs.empty() || free_slots == nullptr) {
+                return;
+            }
+            std::vector<std::pair<const Slab*, std::size_t>> order;   // slab, free slots in it
+            order.reserve(slabs.size());
+            for (const auto& slab : slabs) {
+                order.emplace_back(slab.get(), 0);
+            }
+            auto by_address = [](const auto& a, const auto& b) {
+                return std::less<const Node*>{}(a.first->data, b.first->data);
+            };
+            std::sort(order.begin(), order.end(), by_address);
+            auto owner = [&](const FreeSlot* slot) {
+                const Node* p = reinterpret_cast<const Node*>(slot);
+                auto it = std::upper_bound(order.begin(), order.end(), p, [](const Node* q, const auto& e) {
+                    return std::less<const Node*>{}(q, e.first->data);
+                });
+                return it - 1;   // every free slot lies in one of our slabs
+            };
+            for (FreeSlot* slot = free_slots; slot != nullptr; slot = slot->next) {
+                owner(slot)->second++;
+            }
+            if (std::none_of(order.begin(), order.end(), [](const auto& e) { return e.second == e.first->capacity; })) {
+                return;
+            }
+            FreeSlot** link = &free_slots;
+            while (*link != nullptr) {
+                auto it = owner(*link);
+                if (it->second == it->first->capacity) {
+                    *link = (*link)->next;
+                } else {
+                    link = &(*link)->next;
+                }
+            }
+            std::erase_if(slabs, [&](const std::shared_ptr<Slab>& slab) {
+                auto it = std::lower_bound(order.begin(), order.end(), slab->data, [](const auto& e, const Node* q) {
+                    return std::less<const Node*>{}(e.first->data, q);
+                });
+                return it->second == it->first->capacity;
+            });
+        }
+
+        // number of slabs held, and the node slots in them, used or free
+        std::size_t slab_count() const {
+            return slabs.size();
+        }
+
+        std::size_t slab_capacity() const {
+            std::size_t total = 0;
+            for (const auto& slab : slabs) {
+                total += slab->capacity;
+            }
+            return total;
+        }
+
+        // Shares other's slabs, for when nodes allocated by other now belong to us
+        void adopt(const NodePool& other) {
+            for (const auto& slab : other.slabs) {
+                if (std::find(slabs.begin(), slabs.end(), slab) == slabs.end()) {
+                    slabs.push_back(slab);
+                }
+            }
+        }
+};
+
+}  // namespace dsa::list
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>   // provides std::min
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>   // provides std::exception_ptr
+#include <functional>  // provides std::plus, std::identity, std::function
+#include <memory>      // provides std::shared_ptr
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>     // provides std::move
+#include <vector>
+
+namespace dsa::list {
+
+// Parallel algorithms for the linked lists.
+// The std parallel algorithms can't split a forward range without walking it,
+// so we walk it once ourselves: since size() is known, every chunk gets an exact
+// element count and only its first iterator has to be recorded.
+// Chunks run on a pool of worker threads shared by all calls and started on
+// first use; the calling thread works through chunks too. The first exception
+// thrown by f is rethrown once every chunk has finished.
+namespace detail {
+
+    // Worker threads that run batches of numbered tasks. The thread that
+    // submits a batch claims tasks from it as well, and only waits for tasks
+    // already running elsewhere, so a task may itself run a batch.
+    class WorkerPool {
+        private:
+            struct Batch {
+                const std::function<void(std::size_t)>& task;
+                std::size_t count;
+                std::atomic<std::size_t> next{0};   // first unclaimed task
+                std::mutex lock;
+                std::condition_variable finished;
+                std::size_t done{0};                // guarded by lock
+                std::exception_ptr error;           // guarded by lock
+
+                Batch(const std::function<void(std::size_t)>& t, std::size_t n) : task{t}, count{n} {}
+
+                bool exhausted() const {
+                    return next.load(std::memory_order_relaxed) >= count;
+                }
+
+                // runs claimed tasks until none are left
+                void work() {
+                    for (;;) {
+                        std::size_t i = next.fetch_add(1);
+                        if (i >= count) {
+                            return;
+                        }
+                        std::exception_ptr failed;
+                        try {
+                            task(i);
+                        } catch (...) {
+                            failed = std::current_exception();
+                        }
+                        std::lock_guard<std::mutex> guard(lock);
+                        if (failed && !error) {
+                            error = failed;
+                        }
+                        if (++done == count) {
+                            finished.notify_all();
+                        }
+                    }
+                }
+            };
+
+            std::mutex lock;
+            std::condition_variable wake;
+            std::deque<std::shared_ptr<Batch>> queue;   // guarded by lock
+            bool stopping{false};                       // guarded by lock
+            std::vector<std::thread> workers;
+
+            void worker_loop() {
+                for (;;) {
+                    std::shared_ptr<Batch> batch;
+                    {
+                        std::unique_lock<std::mutex> guard(lock);
+                        wake.wait(guard, [this] { return stopping || !queue.empty(); });
+                        if (queue.empty()) {
+                            return;   // stopping
+                        }
+                        batch = queue.front();
+                        if (batch->exhausted()) {   // every task claimed: drop it
+                            queue.pop_front();
+                            continue;
+                        }
+                    }
+                    batch->work();
+                }
+            }
+
+        public:
+            explicit WorkerPool(unsigned threads) {
+                workers.reserve(threads);
+                for (unsigned i = 0; i < threads; ++i) {
+                    workers.emplace_back([this] { worker_loop(); });
+                }
+            }
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            ~WorkerPool() {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    stopping = true;
+                }
+                wake.notify_all();
+                for (std::thread& t : workers) {
+                    t.join();
+                }
+            }
+
+            // the pool every parallel algorithm uses; one worker fewer than
+            // the hardware threads, since callers take part, but at least one
+            static WorkerPool& shared() {
+                static WorkerPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+                return pool;
+            }
+
+            // Runs task(0) ... task(count - 1), returning once all are done
+            void run(std::size_t count, const std::function<void(std::size_t)>& task) {
+                if (count == 1) {
+                    task(0);
+                    return;
+                }
+                auto batch = std::make_shared<Batch>(task, count);
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    queue.push_back(batch);
+                }
+                wake.notify_all();
+                batch->work();
+                std::unique_lock<std::mutex> guard(batch->lock);
+                batch->finished.wait(guard, [&batch] { return batch->done == batch->count; });
+                if (batch->error) {
+                    std::rethrow_exception(batch->error);
+                }
+            }
+    };
+
+    // lists shorter than this per worker are not worth a thread
+    inline constexpr std::size_t min_chunk_size = 4096;
+
+    inline std::size_t chunk_count(std::size_t n, unsigned threads) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        std::size_t by_size = (n + min_chunk_size - 1) / min_chunk_size;
+        return std::max<std::size_t>(1, std::min<std::size_t>(threads, by_size));
+    }
+
+    // Records the first iterator of every chunk in a single pass.
+    // Chunk i holds n/chunks elements, plus one for the first n%chunks chunks.
+    template <typename Iterator>
+    std::vector<Iterator> chunk_starts(Iterator first, std::size_t n, std::size_t chunks) {
+        std::vector<Iterator> starts;
+        starts.reserve(chunks);
+        std::size_t base = n / chunks;
+        std::size_t extra = n % chunks;
+        for (std::size_t i = 0; i < chunks; ++i) {
+            starts.push_back(first);
+            std::size_t len = base + (i < extra ? 1 : 0);
+            if (i + 1 < chunks) {
+                for (std::size_t k = 0; k < len; ++k) {
+                    ++first;
+                }
+            }
+        }
+        return starts;
+    }
+
+    inline std::size_t chunk_length(std::size_t n, std::size_t chunks, std::size_t i) {
+        return n / chunks + (i < n % chunks ? 1 : 0);
+    }
+}
+
+// Applies f to every element of list, splitting the list across threads.
+// threads == 0 uses std::thread::hardware_concurrency().
+template <typename List, typename Function>
+void parallel_for_each(List& list, Function f, unsigned threads = 0) {
+    std::size_t n = list.size();
+    if (n == 0) {
+        return;
+    }
+    std::size_t chunks = detail::chunk_count(n, threads);
+    auto starts = detail::chunk_starts(list.begin(), n, chunks);
+
+    detail::WorkerPool::shared().run(chunks, [&](std::size_t c) {
+        auto it = starts[c];
+        std::size_t len = detail::chunk_length(n, chunks, c);
+        for (std::size_t i = 0; i < len; ++i, ++it) {
+            f(*it);
+        }
+    });
+}
+
+// Computes reduce(init, transform(x)...) over the list in parallel.
+// reduce must be associative; each chunk is folded separately and the
+// partial results are then combined in list order.
+template <typename List, typename T, typename BinaryOp = std::plus<>,
+          typename UnaryOp = std::identity>
+T parallel_reduce(const List& list, T init, BinaryOp reduce = {},
+                  UnaryOp transform = {}, unsigned threads = 0) {
+    std::size_t n = list.size();
+    if (n == 0) {
+        return init;
+    }
+    std::size_t chunks = detail::chunk_count(n, threads);
+    auto starts = detail::chunk_starts(list.begin(), n, chunks);
+
+    // each chunk starts from its first element, so init is only applied once
+    std::vector<std::optional<T>> partial(chunks);
+    detail::WorkerPool::shared().run(chunks, [&](std::size_t c) {
+        auto it = starts[c];
+        T acc = transform(*it);
+        std::size_t len = detail::chunk_length(n, chunks, c);
+        for (std::size_t i = 1; i < len; ++i) {
+            ++it;
+            acc = reduce(std::move(acc), transform(*it));
+        }
+        partial[c].emplace(std::move(acc));
+    });
+    T result = std::move(init);
+    for (auto& p : partial) {
+        result = reduce(std::move(result), std::move(*p));
+    }
+    return result;
+}
+
+}  // namespace dsa::list
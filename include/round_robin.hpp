@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>     // provides std::move
+
+#include "circularly_linked.hpp"
+
+namespace dsa::sched {
+
+// Round-robin scheduler on a CircularlyLinkedList ring.
+// The front of the ring is the current entry, so current(), remove_current()
+// (pop_front) and moving on to the next entry (rotate) are all O(1); new and
+// reinserted entries join at the back, i.e. are served last in the round.
+//
+// dispatch() adds deficit round robin: whenever an entry becomes current it is
+// credited weight * quantum, and it keeps being dispatched while its credit
+// covers the cost of the next request. Entries with higher weight get a
+// proportionally larger share of the total cost served.
+template <typename T>
+class RoundRobin {
+    public:
+        // an entry with its scheduling state, as taken out by remove_current()
+        struct Entry {
+            T item;
+            std::uint32_t weight;
+            std::int64_t deficit;
+        };
+
+    private:
+        dsa::list::CircularlyLinkedList<Entry> ring;   // front is current
+        std::int64_t quantum;
+
+        void credit_current() {
+            Entry& e = ring.front();
+            e.deficit += quantum * e.weight;
+        }
+
+    public:
+        explicit RoundRobin(std::int64_t quantum_per_weight = 1) : quantum{quantum_per_weight} {
+            if (quantum <= 0) {
+                throw std::invalid_argument("Quantum must be positive");
+            }
+        }
+
+        std::size_t size() const {
+            return ring.size();
+        }
+
+        bool empty() const {
+            return ring.empty();
+        }
+
+        T& current() {
+            return ring.front().item;
+        }
+
+        const T& current() const {
+            return ring.front().item;
+        }
+
+        // Adds item at the back of the round
+        void add(const T& item, std::uint32_t weight = 1) {
+            reinsert(Entry{item, weight, 0});
+        }
+
+        // Puts an entry back at the back of the round, keeping its deficit
+        void reinsert(Entry entry) {
+            if (entry.weight == 0) {
+                throw std::invalid_argument("Weight must be positive");
+            }
+            bool was_empty = ring.empty();
+            ring.push_back(std::move(entry));
+            if (was_empty) {
+                credit_current();
+            }
+        }
+
+        // Removes the current entry in O(1); the next one becomes current
+        Entry remove_current() {
+            if (ring.empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            Entry e = std::move(ring.front());
+            ring.pop_front();
+            if (!ring.empty()) {
+                credit_current();
+            }
+            return e;
+        }
+
+        // Moves on k entries (k is taken modulo size()); the entry reached is credited
+        void advance(std::size_t k = 1) {
+            if (ring.empty()) {
+                return;
+            }
+            k %= ring.size();
+            ring.rotate(static_cast<std::ptrdiff_t>(k));
+            if (k != 0) {
+                credit_current();
+            }
+        }
+
+        // Deficit round robin: returns the entry that should serve a request of
+        // the given cost, charging it, and moving on while the current entry's
+        // credit is too small. Throws if the scheduler is empty.
+        T& dispatch(std::int64_t cost = 1) {
+            if (ring.empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            while (ring.front().deficit < cost) {
+                ring.rotate();
+                credit_current();
+            }
+            Entry& e = ring.front();
+            e.deficit -= cost;
+            return e.item;
+        }
+};
+
+}  // namespace dsa::sched
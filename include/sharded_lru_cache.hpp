@@ -0,0 +1,199 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // provides std::hash, std::equal_to
+#include <memory>      // provides std::unique_ptr
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "lru_cache.hpp"
+
+namespace dsa::cache {
+
+// Thread-safe LRU cache split into independent shards.
+// A key's hash picks its shard; each shard is an LruCache with its own lock,
+// so threads working on different shards never contend. Capacity is divided
+// evenly, which makes eviction LRU per shard rather than globally.
+//
+// With Promotion::lazy, a hit only takes its shard's lock in shared mode and
+// records the key in a per-thread buffer; the buffered promotions are applied
+// together under one exclusive lock once batch of them have gathered for the
+// shard. Recency becomes approximate in exchange for far fewer exclusive locks
+// and list splices. A thread's buffer belongs to the last lazy cache it used;
+// switching to another cache drops the pending (purely advisory) promotions.
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class ShardedLruCache {
+    public:
+        enum class Promotion { eager, lazy };
+        using Stats = typename LruCache<K, V, Hash, KeyEqual>::Stats;
+
+    private:
+        struct alignas(64) Shard {
+            mutable std::shared_mutex lock;
+            LruCache<K, V, Hash, KeyEqual> cache;
+            std::atomic<std::uint64_t> hits{0};
+            std::atomic<std::uint64_t> misses{0};
+
+            explicit Shard(std::size_t capacity) : cache{capacity} {}
+        };
+
+        // promotions waiting to be applied, for one thread
+        struct Pending {
+            std::uint64_t owner{0};   // id of the cache the keys belong to
+            std::vector<std::vector<K>> per_shard;
+        };
+
+        std::vector<std::unique_ptr<Shard>> shards;
+        Hash hasher;
+        Promotion mode;
+        std::size_t batch;
+        std::uint64_t id;
+
+        static std::uint64_t next_id() {
+            static std::atomic<std::uint64_t> counter{0};
+            return ++counter;
+        }
+
+        static Pending& pending() {
+            thread_local Pending local;
+            return local;
+        }
+
+        std::size_t shard_of(const K& key) const {
+            // mix the hash so shards don't depend on the same low bits as the maps inside them
+            std::uint64_t h = static_cast<std::uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>((h >> 32) % shards.size());
+        }
+
+        std::vector<K>& buffer_for(std::size_t s) {
+            Pending& p = pending();
+            if (p.owner != id) {
+                p.owner = id;
+                p.per_shard.assign(shards.size(), {});
+            }
+            return p.per_shard[s];
+        }
+
+        void apply(std::size_t s, std::vector<K>& keys) {
+            std::unique_lock guard(shards[s]->lock);
+            for (const K& key : keys) {
+                shards[s]->cache.touch(key);
+            }
+            keys.clear();
+        }
+
+    public:
+        // capacity is the total over all shards, divided evenly (rounded up)
+        explicit ShardedLruCache(std::size_t capacity, std::size_t shard_count = 16,
+                                 Promotion promotion = Promotion::eager, std::size_t batch_size = 64)
+        : mode{promotion}, batch{batch_size == 0 ? 1 : batch_size}, id{next_id()} {
+            if (shard_count == 0 || capacity < shard_count) {
+                throw std::invalid_argument("Each shard needs a positive capacity");
+            }
+            std::size_t per_shard = (capacity + shard_count - 1) / shard_count;
+            shards.reserve(shard_count);
+            for (std::size_t s = 0; s < shard_count; ++s) {
+                shards.push_back(std::make_unique<Shard>(per_shard));
+            }
+        }
+
+        ShardedLruCache(const ShardedLruCache&) = delete;
+        ShardedLruCache& operator=(const ShardedLruCache&) = delete;
+
+        std::size_t shard_count() const {
+            return shards.size();
+        }
+
+        // Returns a copy of the cached value, or nothing on a miss
+        std::optional<V> get(const K& key) {
+            std::size_t s = shard_of(key);
+            Shard& shard = *shards[s];
+            if (mode == Promotion::eager) {
+                std::unique_lock guard(shard.lock);
+                if (V* value = shard.cache.get(key)) {
+                    shard.hits.fetch_add(1, std::memory_order_relaxed);
+                    return *value;
+                }
+                shard.misses.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            std::optional<V> result;
+            {
+                std::shared_lock guard(shard.lock);
+                if (const V* value = shard.cache.peek(key)) {
+                    result = *value;
+                }
+            }
+            if (!result) {
+                shard.misses.fetch_add(1, std::memory_order_relaxed);
+                return result;
+            }
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            std::vector<K>& keys = buffer_for(s);
+            keys.push_back(key);
+            if (keys.size() >= batch) {
+                apply(s, keys);
+            }
+            return result;
+        }
+
+        void put(const K& key, const V& value) {
+            Shard& shard = *shards[shard_of(key)];
+            std::unique_lock guard(shard.lock);
+            shard.cache.put(key, value);
+        }
+
+        bool erase(const K& key) {
+            Shard& shard = *shards[shard_of(key)];
+            std::unique_lock guard(shard.lock);
+            return shard.cache.erase(key);
+        }
+
+        bool contains(const K& key) const {
+            const Shard& shard = *shards[shard_of(key)];
+            std::shared_lock guard(shard.lock);
+            return shard.cache.contains(key);
+        }
+
+        // Applies the calling thread's buffered promotions now (lazy mode)
+        void flush() {
+            Pending& p = pending();
+            if (p.owner != id) {
+                return;
+            }
+            for (std::size_t s = 0; s < p.per_shard.size(); ++s) {
+                if (!p.per_shard[s].empty()) {
+                    apply(s, p.per_shard[s]);
+                }
+            }
+        }
+
+        std::size_t size() const {
+            std::size_t total = 0;
+            for (const auto& shard : shards) {
+                std::shared_lock guard(shard->lock);
+                total += shard->cache.size();
+            }
+            return total;
+        }
+
+        // totals over all shards
+        Stats stats() const {
+            Stats total;
+            for (const auto& shard : shards) {
+                total.hits += shard->hits.load(std::memory_order_relaxed);
+                total.misses += shard->misses.load(std::memory_order_relaxed);
+                std::shared_lock guard(shard->lock);
+                total.evictions += shard->cache.stats().evictions;
+            }
+            return total;
+        }
+};
+
+}  // namespace dsa::cache
@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>   // provides std::min, std::max
+#include <bit>         // provides std::popcount, std::countr_zero
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace dsa::list::simd {
+
+// Search and reduction kernels over a contiguous run of n elements, used on
+// the element blocks of UnrolledList.
+// The generic versions are plain loops. For std::int32_t, std::int64_t and
+// float there are overloads using SSE2 (every x86-64 target) and, when the
+// compiler targets it (e.g. -mavx2 or -march=native), AVX2; anything the
+// instruction set lacks falls back to the plain loop.
+// Float sums add in a different order than a sequential loop, so they may
+// differ in the last bits; results involving NaNs are unspecified.
+
+// integer sums are taken in 64 bits (wrapping on overflow), others in T
+template <typename T>
+using sum_t = std::conditional_t<std::is_integral_v<T>,
+                                 std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>, T>;
+
+// index of the first element equal to value, or n
+template <typename T>
+std::size_t find(const T* p, std::size_t n, const T& value) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (p[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+template <typename T>
+std::size_t count(const T* p, std::size_t n, const T& value) {
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        c += (p[i] == value);
+    }
+    return c;
+}
+
+// smallest element; n must be positive
+template <typename T>
+T min(const T* p, std::size_t n) {
+    T best = p[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        if (p[i] < best) {
+            best = p[i];
+        }
+    }
+    return best;
+}
+
+// largest element; n must be positive
+template <typename T>
+T max(const T* p, std::size_t n) {
+    T best = p[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        if (best < p[i]) {
+            best = p[i];
+        }
+    }
+    return best;
+}
+
+template <typename T>
+sum_t<T> sum(const T* p, std::size_t n) {
+    if constexpr (std::is_integral_v<T>) {
+        // unsigned arithmetic, so overflow wraps instead of being undefined
+        using U = std::make_unsigned_t<sum_t<T>>;
+        U total = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            total += static_cast<U>(static_cast<sum_t<T>>(p[i]));
+        }
+        return static_cast<sum_t<T>>(total);
+    } else {
+        sum_t<T> total{};
+        for (std::size_t i = 0; i < n; ++i) {
+            total += p[i];
+        }
+        return total;
+    }
+}
+
+#if defined(__SSE2__)
+
+namespace detail {
+
+// sign-extends the four int32 lanes of x and adds them to the two int64 lanes of acc
+inline __m128i add_widened(__m128i acc, __m128i x) {
+    __m128i sign = _mm_srai_epi32(x, 31);
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+    return _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+}
+
+inline std::int64_t horizontal_sum(__m128i acc) {
+    alignas(16) std::int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return static_cast<std::int64_t>(static_cast<std::uint64_t>(lanes[0]) + static_cast<std::uint64_t>(lanes[1]));
+}
+
+// per-lane signed min/max of int32 lanes; SSE2 has only the compare
+inline __m128i select(__m128i take_a, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(take_a, a), _mm_andnot_si128(take_a, b));
+}
+
+// per-lane int64 equality as a 2-bit mask; SSE2 only compares 32-bit halves
+inline int eq64_mask(__m128i a, __m128i b) {
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_movemask_pd(_mm_castsi128_pd(eq));
+}
+
+}  // namespace detail
+
+// ---- std::int32_t
+
+inline std::size_t find(const std::int32_t* p, std::size_t n, const std::int32_t& value) {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256i v8 = _mm256_set1_epi32(value);
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), v8);
+        if (int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq))) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+#endif
+    __m128i v = _mm_set1_epi32(value);
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), v);
+        if (int mask = _mm_movemask_ps(_mm_castsi128_ps(eq))) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+    for (; i < n; ++i) {
+        if (p[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+inline std::size_t count(const std::int32_t* p, std::size_t n, const std::int32_t& value) {
+    std::size_t i = 0;
+    std::size_t c = 0;
+#if defined(__AVX2__)
+    __m256i v8 = _mm256_set1_epi32(value);
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), v8);
+        c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)))));
+    }
+#endif
+    __m128i v = _mm_set1_epi32(value);
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), v);
+        c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)))));
+    }
+    for (; i < n; ++i) {
+        c += (p[i] == value);
+    }
+    return c;
+}
+
+inline std::int32_t min(const std::int32_t* p, std::size_t n) {
+    if (n < 4) {
+        return min<std::int32_t>(p, n);
+    }
+    __m128i best = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        best = detail::select(_mm_cmplt_epi32(x, best), x, best);
+    }
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), best);
+    std::int32_t result = min<std::int32_t>(lanes, 4);
+    return i < n ? std::min(result, min<std::int32_t>(p + i, n - i)) : result;
+}
+
+inline std::int32_t max(const std::int32_t* p, std::size_t n) {
+    if (n < 4) {
+        return max<std::int32_t>(p, n);
+    }
+    __m128i best = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        best = detail::select(_mm_cmpgt_epi32(x, best), x, best);
+    }
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), best);
+    std::int32_t result = max<std::int32_t>(lanes, 4);
+    return i < n ? std::max(result, max<std::int32_t>(p + i, n - i)) : result;
+}
+
+inline std::int64_t sum(const std::int32_t* p, std::size_t n) {
+    std::size_t i = 0;
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 4 <= n; i += 4) {
+        acc = detail::add_widened(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    }
+    std::int64_t total = detail::horizontal_sum(acc);
+    return total + sum<std::int32_t>(p + i, n - i);
+}
+
+// ---- std::int64_t
+
+inline std::size_t find(const std::int64_t* p, std::size_t n, const std::int64_t& value) {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256i v4 = _mm256_set1_epi64x(value);
+    for (; i + 4 <= n; i += 4) {
+        __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), v4);
+        if (int mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq))) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+#endif
+    __m128i v = _mm_set1_epi64x(value);
+    for (; i + 2 <= n; i += 2) {
+        if (int mask = detail::eq64_mask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), v)) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+    return (i < n && p[i] == value) ? i : n;
+}
+
+inline std::size_t count(const std::int64_t* p, std::size_t n, const std::int64_t& value) {
+    std::size_t i = 0;
+    std::size_t c = 0;
+#if defined(__AVX2__)
+    __m256i v4 = _mm256_set1_epi64x(value);
+    for (; i + 4 <= n; i += 4) {
+        __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), v4);
+        c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)))));
+    }
+#endif
+    __m128i v = _mm_set1_epi64x(value);
+    for (; i + 2 <= n; i += 2) {
+        c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(
+            detail::eq64_mask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), v))));
+    }
+    return c + (i < n && p[i] == value);
+}
+
+#if defined(__AVX2__)
+// SSE2 has no 64-bit compare, so min and max use the plain loop without AVX2
+inline std::int64_t min(const std::int64_t* p, std::size_t n) {
+    if (n < 4) {
+        return min<std::int64_t>(p, n);
+    }
+    __m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        best = _mm256_blendv_epi8(best, x, _mm256_cmpgt_epi64(best, x));
+    }
+    alignas(32) std::int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best);
+    std::int64_t result = min<std::int64_t>(lanes, 4);
+    return i < n ? std::min(result, min<std::int64_t>(p + i, n - i)) : result;
+}
+
+inline std::int64_t max(const std::int64_t* p, std::size_t n) {
+    if (n < 4) {
+        return max<std::int64_t>(p, n);
+    }
+    __m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        best = _mm256_blendv_epi8(best, x, _mm256_cmpgt_epi64(x, best));
+    }
+    alignas(32) std::int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best);
+    std::int64_t result = max<std::int64_t>(lanes, 4);
+    return i < n ? std::max(result, max<std::int64_t>(p + i, n - i)) : result;
+}
+#endif
+
+inline std::int64_t sum(const std::int64_t* p, std::size_t n) {
+    std::size_t i = 0;
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 2 <= n; i += 2) {
+        acc = _mm_add_epi64(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    }
+    std::int64_t total = detail::horizontal_sum(acc);
+    return static_cast<std::int64_t>(static_cast<std::uint64_t>(total)
+                                     + static_cast<std::uint64_t>(sum<std::int64_t>(p + i, n - i)));
+}
+
+// ---- float
+
+inline std::size_t find(const float* p, std::size_t n, const float& value) {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256 v8 = _mm256_set1_ps(value);
+    for (; i + 8 <= n; i += 8) {
+        if (int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), v8, _CMP_EQ_OQ))) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+#endif
+    __m128 v = _mm_set1_ps(value);
+    for (; i + 4 <= n; i += 4) {
+        if (int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v))) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+    for (; i < n; ++i) {
+        if (p[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+inline std::size_t count(const float* p, std::size_t n, const float& value) {
+    std::size_t i = 0;
+    std::size_t c = 0;
+#if defined(__AVX2__)
+    __m256 v8 = _mm256_set1_ps(value);
+    for (; i + 8 <= n; i += 8) {
+        c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), v8, _CMP_EQ_OQ)))));
+    }
+#endif
+    __m128 v = _mm_set1_ps(value);
+    for (; i + 4 <= n; i += 4) {
+        c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(
+            _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v)))));
+    }
+    for (; i < n; ++i) {
+        c += (p[i] == value);
+    }
+    return c;
+}
+
+inline float min(const float* p, std::size_t n) {
+    if (n < 4) {
+        return min<float>(p, n);
+    }
+    __m128 best = _mm_loadu_ps(p);
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        best = _mm_min_ps(best, _mm_loadu_ps(p + i));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, best);
+    float result = min<float>(lanes, 4);
+    return i < n ? std::min(result, min<float>(p + i, n - i)) : result;
+}
+
+inline float max(const float* p, std::size_t n) {
+    if (n < 4) {
+        return max<float>(p, n);
+    }
+    __m128 best = _mm_loadu_ps(p);
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        best = _mm_max_ps(best, _mm_loadu_ps(p + i));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, best);
+    float result = max<float>(lanes, 4);
+    return i < n ? std::max(result, max<float>(p + i, n - i)) : result;
+}
+
+inline float sum(const float* p, std::size_t n) {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256 acc8 = _mm256_setzero_ps();
+    for (; i + 8 <= n; i += 8) {
+        acc8 = _mm256_add_ps(acc8, _mm256_loadu_ps(p + i));
+    }
+    __m128 acc = _mm_add_ps(_mm256_castps256_ps128(acc8), _mm256_extractf128_ps(acc8, 1));
+#else
+    __m128 acc = _mm_setzero_ps();
+#endif
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_add_ps(acc, _mm_loadu_ps(p + i));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sum<float>(p + i, n - i);
+}
+
+#endif  // __SSE2__
+
+}  // namespace dsa::list::simd
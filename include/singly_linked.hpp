@@ -1,33 +1,371 @@
 #pragma once
 
+#include <algorithm> // for std::min
+#include <bit>       // for std::countr_one
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>    // for std::unique_ptr
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 #include <utility> // for std::swap
+#include <vector>
+
+#include "list_io.hpp"
+#include "node_layout.hpp"
+#include "node_pool.hpp"
 
 namespace dsa::list {
 
 // similar to std::forward_list
-template <typename T>
+// SizeType counts the elements; std::uint32_t saves space for lists that stay small.
+// Layout places the element in the node (see node_layout.hpp).
+// The const lookups at() and lower_bound() build the skip index on first use,
+// so several threads may only call them at once after build_index() has run
+// since the last change.
+template <typename T, std::unsigned_integral SizeType = std::size_t, typename Layout = layout::inline_payload>
 class SinglyLinkedList {
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = SizeType;
+        using difference_type = std::ptrdiff_t;
+
     private:
-        class Node {
+        class alignas(Layout::node_alignment) alignas(T) Node {
             public:
                 Node* next;   // pointer to next node
-                T elem;       // element
+                typename Layout::template payload<T> data;   // element
                 Node(const T& element, Node* nxt = nullptr) 
-                : elem{element}, next{nxt} {}
+                : next{nxt}, data{element} {}
+                // takes over other's element, for compact()
+                Node(Node&& other, Node* nxt)
+                : next{nxt}, data{std::move(other.data)} {}
+
+                T& elem() { return data.get(); }
+                const T& elem() const { return data.get(); }
         };
 
-        int sz{0};
+        SizeType sz{0};
         Node* head{nullptr};
         Node* tail{nullptr};
+        NodePool<Node> pool;  // where nodes are allocated and freed
+
+        // Optional skip-list index over the nodes, used by at(), lower_bound()
+        // and insert_sorted(). Towers stand on existing nodes and add express
+        // lanes; each link records how many base nodes it skips (its width),
+        // so positions can be found as well as keys. Base positions run from
+        // 0 (the head tower, before the first node) to sz + 1 (the end).
+        // push_*, pop_front, insert_after, erase_after and insert_sorted keep
+        // it up to date in expected O(log n); any other mutation drops it and
+        // the next indexed call rebuilds it in O(n).
+        class SkipIndex {
+            public:
+                static constexpr int max_levels = 32;
+
+                using Id = std::size_t;                   // a tower's slot in towers
+                static constexpr Id none = ~Id{0};        // no tower: the end of a level
+                static constexpr Id head = 0;
+
+                struct Link {
+                    Id next;            // next tower on this level, none at the end
+                    SizeType width;     // base positions from this tower to next; at the end
+                                        // it runs to sz + 1, which may wrap and is never read
+                };
+                struct Tower {
+                    Node* node;         // nullptr for the head tower (position 0)
+                    std::size_t first;  // its levels are links[first, first + height)
+                    int height;
+                };
+
+                std::vector<Tower> towers;   // towers[0] is the head
+                std::vector<Link> links;     // every tower's levels, one block each;
+                                             // the head's block has room for max_levels
+                std::vector<Id> spare[max_levels + 1];   // removed towers by height, for reuse
+                std::unordered_map<const Node*, Id> tower_of;
+                std::mt19937 rng{0x5eed};
+
+                Link& link(Id t, int level) {
+                    return links[towers[t].first + static_cast<std::size_t>(level)];
+                }
+
+                int levels() const {
+                    return towers[head].height;
+                }
+
+                // number of express levels for a new node: 0 with probability 1/2
+                int random_height() {
+                    return std::min(std::countr_one(static_cast<std::uint32_t>(rng())), max_levels);
+                }
+
+                // a tower of height h on node, reusing a removed one if it can
+                Id add_tower(Node* node, int h) {
+                    Id t;
+                    if (!spare[h].empty()) {
+                        t = spare[h].back();
+                        spare[h].pop_back();
+                        towers[t].node = node;
+                    } else {
+                        t = towers.size();
+                        towers.push_back(Tower{node, links.size(), h});
+                        links.resize(links.size() + static_cast<std::size_t>(h));
+                    }
+                    tower_of.emplace(node, t);
+                    return t;
+                }
+
+                // builds towers over the nodes of list, in order
+                explicit SkipIndex(const SinglyLinkedList& list) {
+                    towers.push_back(Tower{nullptr, 0, 0});
+                    links.resize(max_levels, Link{none, 0});
+                    Id last[max_levels];
+                    SizeType last_pos[max_levels];
+                    SizeType pos = 0;
+                    for (Node* p = list.head; p != nullptr; p = p->next) {
+                        ++pos;
+                        int h = random_height();
+                        if (h == 0) {
+                            continue;
+                        }
+                        Id t = add_tower(p, h);
+                        while (levels() < h) {
+                            last[levels()] = head;
+                            last_pos[levels()] = 0;
+                            towers[head].height++;
+                        }
+                        for (int l = 0; l < h; ++l) {
+                            link(last[l], l) = Link{t, static_cast<SizeType>(pos - last_pos[l])};
+                            last[l] = t;
+                            last_pos[l] = pos;
+                        }
+                    }
+                    for (int l = 0; l < levels(); ++l) {
+                        link(last[l], l) = Link{none, static_cast<SizeType>(list.sz + 1 - last_pos[l])};
+                    }
+                }
+
+                // per level, the last tower before base position pos, and its position
+                void predecessors(SizeType pos, Id* update, SizeType* rank) {
+                    Id t = head;
+                    SizeType at = 0;
+                    for (int l = levels() - 1; l >= 0; --l) {
+                        while (link(t, l).next != none && static_cast<SizeType>(at + link(t, l).width) < pos) {
+                            at += link(t, l).width;
+                            t = link(t, l).next;
+                        }
+                        update[l] = t;
+                        rank[l] = at;
+                    }
+                }
+
+                // Records node, just linked in at base position pos of a list
+                // that held size nodes before, given pos's predecessors.
+                void insert(Node* node, SizeType pos, SizeType size, Id* update, SizeType* rank) {
+                    int h = random_height();
+                    Id t = (h > 0) ? add_tower(node, h) : none;
+                    while (levels() < h) {
+                        // a new level starts at the head and runs to the end (size + 1)
+                        link(head, levels()) = Link{none, static_cast<SizeType>(size + 1)};
+                        update[levels()] = head;
+                        rank[levels()] = 0;
+                        towers[head].height++;
+                    }
+                    for (int l = 0; l < levels(); ++l) {
+                        Link& up = link(update[l], l);
+                        if (l < h) {
+                            SizeType next_pos = static_cast<SizeType>(rank[l] + up.width + 1);
+                            link(t, l) = Link{up.next, static_cast<SizeType>(next_pos - pos)};
+                            up = Link{t, static_cast<SizeType>(pos - rank[l])};
+                        } else {
+                            up.width++;
+                        }
+                    }
+                }
+
+                void insert(Node* node, SizeType pos, SizeType size) {
+                    Id update[max_levels];
+                    SizeType rank[max_levels];
+                    predecessors(pos, update, rank);
+                    insert(node, pos, size, update, rank);
+                }
+
+                // forgets the node at base position pos, about to be unlinked
+                void erase(SizeType pos) {
+                    Id update[max_levels];
+                    SizeType rank[max_levels];
+                    predecessors(pos, update, rank);
+                    Id gone = none;
+                    for (int l = 0; l < levels(); ++l) {
+                        Link& up = link(update[l], l);
+                        if (up.next != none && static_cast<SizeType>(rank[l] + up.width) == pos) {
+                            gone = up.next;
+                            const Link& down = link(gone, l);
+                            up = Link{down.next, static_cast<SizeType>(up.width + down.width - 1)};
+                        } else {
+                            up.width--;
+                        }
+                    }
+                    if (gone != none) {
+                        tower_of.erase(towers[gone].node);
+                        spare[towers[gone].height].push_back(gone);
+                    }
+                }
+
+                // Base position of node in a list of size nodes: walks to the
+                // next tower (about two steps), then along the top levels to
+                // the end. Expected O(log n).
+                SizeType position(const Node* node, SizeType size) {
+                    SizeType steps = 0;
+                    SizeType to_end = 0;
+                    for (const Node* p = node; p != nullptr; p = p->next, ++steps) {
+                        auto found = tower_of.find(p);
+                        if (found != tower_of.end()) {
+                            for (Id t = found->second; t != none; ) {
+                                const Link& up = link(t, towers[t].height - 1);
+                                to_end += up.width;
+                                t = up.next;
+                            }
+                            break;
+                        }
+                    }
+                    return static_cast<SizeType>(size + 1 - to_end - steps);
+                }
+        };
+
+        mutable std::unique_ptr<SkipIndex> index;
+
+        SkipIndex& ensure_index() const {
+            if (!index) {
+                index = std::make_unique<SkipIndex>(*this);
+            }
+            return *index;
+        }
+
+        // called by every mutation that doesn't maintain the index itself
+        void drop_index() {
+            index.reset();
+        }
+
+        // Tells the index, if there is one, that node was linked in at base
+        // position pos (sz already counts it) or that the node at pos is about
+        // to be unlinked (sz still counts it). Should the index run out of
+        // memory it is dropped instead, to be rebuilt on its next use.
+        void index_inserted(Node* node, SizeType pos) {
+            if (index) {
+                try {
+                    index->insert(node, pos, static_cast<SizeType>(sz - 1));
+                } catch (...) {
+                    drop_index();
+                }
+            }
+        }
+
+        void index_erased(SizeType pos) {
+            if (index) {
+                try {
+                    index->erase(pos);
+                } catch (...) {
+                    drop_index();
+                }
+            }
+        }
+
+        // throws std::length_error unless n more elements fit in size_type
+        void check_room(std::size_t n = 1) const {
+            if (n > static_cast<std::size_t>(max_size() - sz)) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+        }
+
+        // Size of the union of sorted lists a and b; the pairs are only
+        // counted when the plain total might not fit in size_type.
+        static std::size_t union_size(const SinglyLinkedList& a, const SinglyLinkedList& b) {
+            std::size_t total = std::size_t{a.sz} + b.sz;
+            if (total <= max_size()) {
+                return total;
+            }
+            const Node* p = a.head;
+            const Node* q = b.head;
+            while (p != nullptr && q != nullptr) {
+                if (p->elem() < q->elem()) {
+                    p = p->next;
+                } else if (q->elem() < p->elem()) {
+                    q = q->next;
+                } else {
+                    total--;
+                    p = p->next;
+                    q = q->next;
+                }
+            }
+            return total;
+        }
+
+        // State of an incremental compact() pass: the first used slots of slab
+        // hold the nodes relocated so far, in list order, and last is the most
+        // recent of them (nullptr before the first).
+        struct Compaction {
+            Node* slab;
+            SizeType capacity;
+            SizeType used;
+            Node* last;
+        };
+        std::unique_ptr<Compaction> compaction;
+
+        // ends a compact() pass, handing the slab's unused slots to the pool
+        // and freeing the slabs the pass has emptied
+        void stop_compaction() {
+            if (!compaction) {
+                return;
+            }
+            for (SizeType i = compaction->used; i < compaction->capacity; ++i) {
+                pool.deallocate(compaction->slab + i);
+            }
+            compaction.reset();
+            pool.release_empty_slabs();
+        }
+
+        // destroys a node that has been unlinked
+        void release_node(Node* node) {
+            if (compaction && compaction->last == node) {
+                stop_compaction();   // the pass can't resume from a node that's gone
+            }
+            pool.destroy(node);
+        }
+
+        // destroys a chain of unlinked nodes, from first along next to nullptr
+        void release_chain(Node* first) {
+            if (compaction) {
+                for (Node* p = first; p != nullptr; p = p->next) {
+                    if (p == compaction->last) {
+                        stop_compaction();
+                        break;
+                    }
+                }
+            }
+            pool.destroy_chain(first);
+        }
 
     public:
         
         // ToDo: Constructs an empty list
         SinglyLinkedList() : sz{0}, head{nullptr}, tail{nullptr} {}
 
-        int size() const {
+        size_type size() const {
             return sz;
         }
+
+        // largest size the size type can count; growing past it throws
+        // std::length_error
+        static constexpr size_type max_size() {
+            return std::numeric_limits<size_type>::max();
+        }
     
         bool empty() const {
             return sz == 0;
@@ -37,37 +375,39 @@ class SinglyLinkedList {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return head->elem;
+            return head->elem();
         }
 
         const T& front() const {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return head->elem;
+            return head->elem();
         }
 
         T& back() {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return tail->elem;
+            return tail->elem();
         }
     
         const T& back() const {
             if (empty()) {
                 throw std::runtime_error("Empty List");
             }
-            return tail->elem;
+            return tail->elem();
         }
 
         void push_front(const T& elem) {
-            head = new Node(elem, head);
+            check_room();
+            head = pool.create(elem, head);
 
             if (sz == 0) {
                 tail = head;
             }
             sz++;
+            index_inserted(head, 1);
         }
 
         void pop_front() {
@@ -75,9 +415,10 @@ class SinglyLinkedList {
                 return;
             }
 
+            index_erased(1);
             Node* origHead = head; //saves the original head
             head = head->next; 
-            delete origHead; //deletes if not needed
+            release_node(origHead); //deletes if not needed
             sz--;
 
             if (sz == 0) { //if list goes empty, tail is empty
@@ -86,7 +427,8 @@ class SinglyLinkedList {
         }
 
         void push_back(const T& elem) {
-            Node* newNode = new Node(elem);
+            check_room();
+            Node* newNode = pool.create(elem);
 
             if (sz == 0) {//makes new nodes take place for empty list
                 head = newNode;
@@ -97,6 +439,7 @@ class SinglyLinkedList {
                 tail = newNode;
             }
             sz++;
+            index_inserted(newNode, sz);
         }
 
     // Concatenate attaches the contents of another list M 
@@ -109,6 +452,11 @@ class SinglyLinkedList {
         if (M.sz == 0) 
             return;
 
+        check_room(M.sz);
+        drop_index();
+        M.drop_index();
+        M.stop_compaction();
+        pool.adopt(M.pool);   // M's nodes may live in its slabs
         if (sz == 0) {
             head = M.head;
             tail = M.tail;
@@ -127,6 +475,8 @@ class SinglyLinkedList {
         if (sz <= 1) 
             return;  // empty or single-node list
         
+            drop_index();
+            stop_compaction();   // relocated nodes would no longer be a prefix
             Node* past_node = nullptr;
             Node* current_node = head;
             Node* next_node = nullptr;
@@ -144,22 +494,32 @@ class SinglyLinkedList {
             
     }
 
+    class const_iterator;
+
+    // models std::forward_iterator
     class iterator {
         // needed for SinglyLinkedLists's insert_after and erase_after
         friend class SinglyLinkedList;
+        friend class const_iterator;
 
         private:
             Node* node_ptr;  // pointer to a node
 
         public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
             iterator(Node* ptr = nullptr) 
             : node_ptr(ptr) {}
 
             T& operator*() const { 
-                return node_ptr->elem;
+                return node_ptr->elem();
             }
             T* operator->() const {
-                return &(node_ptr->elem);
+                return &(node_ptr->elem());
             }
             iterator& operator++() {
                 node_ptr = node_ptr->next;
@@ -183,14 +543,22 @@ class SinglyLinkedList {
             Node* node_ptr;  // pointer to a node
 
         public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
             const_iterator(Node* ptr = nullptr)
             : node_ptr(ptr) {}
+            const_iterator(iterator it)
+            : node_ptr(it.node_ptr) {}
 
             const T& operator*() const {
-                return node_ptr->elem;
+                return node_ptr->elem();
             }
             const T* operator->() const {
-                return &(node_ptr->elem);
+                return &(node_ptr->elem());
             }
             const_iterator& operator++() {
                 node_ptr = node_ptr->next;
@@ -225,19 +593,63 @@ class SinglyLinkedList {
         return const_iterator(nullptr);
     }
 
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // Reverses the elements in [first, last) by relinking their nodes, so
+    // iterators stay valid. Without back links the node before first has to
+    // be found from head: O(distance(begin(), last)).
+    void reverse(iterator first, iterator last) {
+        Node* a = first.node_ptr;
+        Node* after = last.node_ptr;
+        if (a == nullptr || a == after || a->next == after) {
+            return;   // fewer than two elements
+        }
+        Node* before = nullptr;
+        if (a != head) {
+            before = head;
+            while (before->next != a) {
+                before = before->next;
+            }
+        }
+
+        drop_index();
+        stop_compaction();   // relocated nodes would no longer be a prefix
+        Node* past_node = after;
+        Node* current_node = a;
+        while (current_node != after) {
+            Node* next_node = current_node->next;
+            current_node->next = past_node;
+            past_node = current_node;
+            current_node = next_node;
+        }
+        (before == nullptr ? head : before->next) = past_node;
+        if (after == nullptr) {
+            tail = a;
+        }
+    }
+
     iterator insert_after(iterator it, const T& elem) {
         Node* current_node = it.node_ptr;
         if (current_node == nullptr) {
             throw std::runtime_error("Can't inster after end iterator");
         }
 
-        Node* new_node = new Node(elem, current_node->next);
+        check_room();
+        SizeType pos = index ? index->position(current_node, sz) : 0;
+        Node* new_node = pool.create(elem, current_node->next);
         current_node->next = new_node;
         
         if(current_node == tail) {
             tail = new_node;
         }
         sz++;
+        index_inserted(new_node, static_cast<SizeType>(pos + 1));
         return iterator(new_node);
     }
 
@@ -248,18 +660,531 @@ class SinglyLinkedList {
             throw std::runtime_error("Can't erase, there is nothing after iterator");
         }
 
+        if (index) {
+            index_erased(static_cast<SizeType>(index->position(current_node, sz) + 1));
+        }
         Node* node_delete = current_node->next;
         current_node->next = node_delete->next;
         
         if(node_delete == tail) {
             tail = current_node;
         }
-        delete node_delete;
+        release_node(node_delete);
         sz--;
         return iterator(current_node->next);
     }
 
+    // Removes every element for which pred returns true and returns how many
+    // were removed. Matches are unlinked in one pass onto a detached chain that
+    // is freed at the end, so nothing is freed while pred is running. If pred
+    // throws, the elements removed so far stay removed.
+    template <typename Pred>
+    size_type remove_if(Pred pred) {
+        Node* removed = nullptr;
+        Node** removed_end = &removed;
+        size_type count = 0;
+        Node** link = &head;
+        Node* last = nullptr;   // last node kept
+        try {
+            while (*link != nullptr) {
+                Node* node = *link;
+                if (pred(node->elem())) {
+                    *link = node->next;
+                    *removed_end = node;
+                    removed_end = &node->next;
+                    count++;
+                } else {
+                    last = node;
+                    link = &node->next;
+                }
+            }
+            tail = last;   // the old tail was either kept or removed
+        } catch (...) {
+            finish_removal(removed, removed_end, count);
+            throw;
+        }
+        finish_removal(removed, removed_end, count);
+        return count;
+    }
+
+    size_type remove(const T& value) {
+        return remove_if([&value](const T& elem) { return elem == value; });
+    }
+
+    // Removes all but the first of each run of consecutive elements for which
+    // eq(kept, elem) is true, batching the frees like remove_if().
+    template <typename BinaryPred>
+    size_type unique(BinaryPred eq) {
+        if (sz <= 1) {
+            return 0;
+        }
+        Node* removed = nullptr;
+        Node** removed_end = &removed;
+        size_type count = 0;
+        Node* kept = head;
+        try {
+            while (kept->next != nullptr) {
+                Node* node = kept->next;
+                if (eq(kept->elem(), node->elem())) {
+                    kept->next = node->next;
+                    *removed_end = node;
+                    removed_end = &node->next;
+                    count++;
+                } else {
+                    kept = node;
+                }
+            }
+            tail = kept;
+        } catch (...) {
+            finish_removal(removed, removed_end, count);
+            throw;
+        }
+        finish_removal(removed, removed_end, count);
+        return count;
+    }
+
+    size_type unique() {
+        return unique([](const T& a, const T& b) { return a == b; });
+    }
+
+    // Set operations on sorted lists (by operator<), with the multiset
+    // semantics of std::set_union and friends: an element occurring m times
+    // here and n times in other occurs max(m, n) times in the union, min(m, n)
+    // in the intersection and m - n (if positive) in the difference.
+    // The members work in place: they relink and free nodes but never
+    // allocate. When one side is much shorter, its elements are looked up in
+    // the longer list through that list's skip index if it already has one,
+    // or else by exponential search forward, which still follows every link
+    // but compares only O(log gap) elements. No index is ever built, so the
+    // const argument is only read. The non-member versions build a new list
+    // in one bulk allocation.
+
+    // Merges other into this list and leaves other empty; other's elements
+    // that pair up with equal ones here are freed. O(n + m).
+    void set_union(SinglyLinkedList& other) {
+        if (this == &other || other.sz == 0) {
+            return;
+        }
+        if (union_size(*this, other) > max_size()) {
+            throw std::length_error("List size would exceed max_size()");
+        }
+        other.drop_index();
+        other.stop_compaction();
+        stop_compaction();   // other's nodes would land inside a relocated prefix
+        pool.adopt(other.pool);   // other's nodes may live in its slabs
+        Node* b = other.head;
+        const bool gallop = index != nullptr && gallops(other.sz, sz);
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.sz = 0;
+
+        Node* dropped = nullptr;
+        Node** dropped_end = &dropped;
+        Node* prev = nullptr;
+        Node* p = head;
+        while (b != nullptr) {
+            if (gallop && p != nullptr && p->elem() < b->elem()) {
+                prev = node_before(b->elem());   // still right: nothing indexed has been unlinked
+                p = prev->next;
+            }
+            Node* next = b->next;
+            if (p == nullptr || b->elem() < p->elem()) {
+                b->next = p;
+                (prev == nullptr ? head : prev->next) = b;
+                prev = b;
+                sz++;
+            } else if (p->elem() < b->elem()) {
+                prev = p;
+                p = p->next;
+                continue;
+            } else {
+                *dropped_end = b;   // paired with p
+                dropped_end = &b->next;
+                prev = p;
+                p = p->next;
+            }
+            b = next;
+        }
+        if (p == nullptr) {
+            tail = prev;
+        }
+        *dropped_end = nullptr;
+        drop_index();
+        pool.destroy_chain(dropped);
+    }
+
+    // Keeps only the elements that pair up with equal ones in other.
+    void set_intersection(const SinglyLinkedList& other) {
+        if (this == &other) {
+            return;
+        }
+        Node* q = other.head;
+        const bool gallop = gallops(sz, other.sz);
+        remove_if([&](const T& elem) { return !other.take_match(q, elem, gallop); });
+    }
+
+    // Removes the elements that pair up with equal ones in other.
+    void set_difference(const SinglyLinkedList& other) {
+        if (this == &other) {
+            clear();
+            return;
+        }
+        Node* q = other.head;
+        const bool gallop = gallops(sz, other.sz);
+        remove_if([&](const T& elem) { return other.take_match(q, elem, gallop); });
+    }
+
+    // Builds the skip index now, in O(n), unless it is already up to date.
+    // Afterwards the const lookups only read the list until it next changes.
+    void build_index() {
+        ensure_index();
+    }
+
+    // Returns the element at position k (0-based) in expected O(log n)
+    // using the skip index; throws std::out_of_range if k >= size().
+    T& at(size_type k) {
+        return node_at(k)->elem();
+    }
+
+    const T& at(size_type k) const {
+        return node_at(k)->elem();
+    }
+
+    // Returns an iterator to the first element not less than key, or end().
+    // Presumes the list is sorted by operator<; expected O(log n).
+    iterator lower_bound(const T& key) {
+        Node* prev = node_before(key);
+        return iterator(prev == nullptr ? head : prev->next);
+    }
+
+    const_iterator lower_bound(const T& key) const {
+        Node* prev = node_before(key);
+        return const_iterator(prev == nullptr ? head : prev->next);
+    }
+
+    // Inserts elem after any equal elements of a sorted list and returns an
+    // iterator to it, keeping the skip index up to date; expected O(log n).
+    iterator insert_sorted(const T& elem) {
+        check_room();
+        SkipIndex& idx = ensure_index();
+        using Id = typename SkipIndex::Id;
+
+        // per-level predecessor towers and their positions
+        Id update[SkipIndex::max_levels];
+        SizeType rank[SkipIndex::max_levels];
+        Id t = SkipIndex::head;
+        SizeType pos = 0;
+        for (int l = idx.levels() - 1; l >= 0; --l) {
+            while (idx.link(t, l).next != SkipIndex::none
+                   && !(elem < idx.towers[idx.link(t, l).next].node->elem())) {
+                pos += idx.link(t, l).width;
+                t = idx.link(t, l).next;
+            }
+            update[l] = t;
+            rank[l] = pos;
+        }
+
+        Node* prev = idx.towers[t].node;
+        Node* p = (prev == nullptr) ? head : prev->next;
+        while (p != nullptr && !(elem < p->elem())) {
+            prev = p;
+            p = p->next;
+            ++pos;
+        }
+
+        Node* new_node = pool.create(elem, p);
+        if (prev == nullptr) {
+            head = new_node;
+        } else {
+            prev->next = new_node;
+        }
+        if (p == nullptr) {
+            tail = new_node;
+        }
+        sz++;
+        try {
+            idx.insert(new_node, static_cast<SizeType>(pos + 1), static_cast<SizeType>(sz - 1), update, rank);
+        } catch (...) {
+            drop_index();
+        }
+        return iterator(new_node);
+    }
+
+    // Moves every node into one new block, in list order, and frees the old
+    // storage, so traversal walks memory sequentially again. O(n). Elements
+    // are moved, not copied; iterators and references are invalidated.
+    void compact() requires std::is_nothrow_move_constructible_v<typename Layout::template payload<T>> {
+        stop_compaction();
+        if (sz == 0) {
+            return;
+        }
+        drop_index();
+        NodePool<Node> fresh;
+        Node* slots = fresh.bulk(sz);
+        Node* prev = nullptr;
+        for (Node* p = head; p != nullptr; ) {
+            Node* next = p->next;
+            Node* moved = std::construct_at(slots++, std::move(*p), nullptr);
+            (prev == nullptr ? head : prev->next) = moved;
+            pool.destroy(p);
+            prev = moved;
+            p = next;
+        }
+        tail = prev;
+        swap(pool, fresh);   // the old pool and its slabs go now (unless shared)
+    }
+
+    // slabs backing this list's nodes, and the node slots in them, used or free
+    std::size_t slab_count() const {
+        return pool.slab_count();
+    }
+
+    std::size_t slab_capacity() const {
+        return pool.slab_capacity();
+    }
+
+    // Incremental compact(): relocates at most budget nodes into a block
+    // reserved for the pass and returns true once the pass is complete.
+    // Call it again to continue; the list may be changed between calls. A
+    // pass stops early if the last node it relocated is erased or the list is
+    // reversed. When a pass ends, slabs it left with no nodes are freed, so
+    // repeated passes don't pile up storage. Iterators and references to
+    // relocated nodes are invalidated.
+    bool compact(size_type budget) requires std::is_nothrow_move_constructible_v<typename Layout::template payload<T>> {
+        if (!compaction) {
+            if (sz == 0) {
+                return true;
+            }
+            compaction = std::make_unique<Compaction>(Compaction{pool.bulk(sz), sz, 0, nullptr});
+        }
+        drop_index();
+        Compaction& c = *compaction;
+        Node* prev = c.last;
+        Node* p = (prev == nullptr) ? head : prev->next;
+        for (; budget > 0 && p != nullptr && c.used < c.capacity; --budget) {
+            Node* next = p->next;
+            Node* moved = std::construct_at(c.slab + c.used++, std::move(*p), next);
+            (prev == nullptr ? head : prev->next) = moved;
+            if (tail == p) {
+                tail = moved;
+            }
+            pool.destroy(p);
+            prev = moved;
+            p = next;
+        }
+        c.last = prev;
+        if (p == nullptr || c.used == c.capacity) {
+            stop_compaction();
+            return true;
+        }
+        return false;
+    }
+
+    // Writes the list in the binary format of list_io.hpp: a header, then all
+    // elements back to back. T must be trivially copyable.
+    void save(std::ostream& out) const requires std::is_trivially_copyable_v<T> {
+        io::StreamSink sink(out);
+        save_to(sink);
+    }
+
+    // Replaces the contents with a list written by save(). When the input can
+    // seek, all nodes are built in one bulk allocation; otherwise slabs grow as
+    // elements arrive, so a corrupt count can't force a huge allocation.
+    // Throws std::runtime_error on malformed input and leaves the list unchanged.
+    void load(std::istream& in) requires std::is_trivially_copyable_v<T> {
+        io::StreamSource source(in);
+        load_from(source);
+    }
+
+#ifdef DSA_LIST_HAS_FD_IO
+    // As above, on a POSIX file descriptor, starting at its current offset
+    void save(int fd) const requires std::is_trivially_copyable_v<T> {
+        io::FdSink sink(fd);
+        save_to(sink);
+    }
+
+    void load(int fd) requires std::is_trivially_copyable_v<T> {
+        io::FdSource source(fd);
+        load_from(source);
+    }
+#endif
+
     private:
+        template <typename Sink>
+        void save_to(Sink& sink) const {
+            io::write_list<T>(sink, sz, [this](auto&& emit) {
+                for (Node* p = head; p != nullptr; p = p->next) {
+                    emit(p->elem());
+                }
+            });
+        }
+
+        template <typename Source>
+        void load_from(Source& source) {
+            std::uint64_t n = io::read_header<T>(source);
+            if (n > static_cast<std::uint64_t>(max_size())) {
+                throw std::runtime_error("List load failed: too many elements");
+            }
+            std::uint64_t first = io::first_batch<T>(source, n);
+            SinglyLinkedList fresh;
+            typename NodePool<Node>::Feed slots(fresh.pool, n, first);
+            io::read_elements<T>(source, n, [&fresh, &slots](const T& elem) {
+                Node* node = std::construct_at(slots.next(), elem);
+                if (fresh.tail == nullptr) {
+                    fresh.head = node;
+                } else {
+                    fresh.tail->next = node;
+                }
+                fresh.tail = node;
+                fresh.sz++;
+            });
+            swap(*this, fresh);
+        }
+
+        Node* node_at(size_type k) const {
+            if (k >= sz) {
+                throw std::out_of_range("Index out of range");
+            }
+            SkipIndex& idx = ensure_index();
+            typename SkipIndex::Id t = SkipIndex::head;
+            SizeType pos = 0;
+            SizeType target = k + 1;
+            for (int l = idx.levels() - 1; l >= 0; --l) {
+                while (idx.link(t, l).next != SkipIndex::none && pos + idx.link(t, l).width <= target) {
+                    pos += idx.link(t, l).width;
+                    t = idx.link(t, l).next;
+                }
+            }
+            Node* p = idx.towers[t].node;
+            for (; pos < target; ++pos) {
+                p = (p == nullptr) ? head : p->next;
+            }
+            return p;
+        }
+
+        // last node whose element is less than key, or nullptr; expected O(log n)
+        Node* node_before(const T& key) const {
+            SkipIndex& idx = ensure_index();
+            typename SkipIndex::Id t = SkipIndex::head;
+            for (int l = idx.levels() - 1; l >= 0; --l) {
+                while (idx.link(t, l).next != SkipIndex::none && idx.towers[idx.link(t, l).next].node->elem() < key) {
+                    t = idx.link(t, l).next;
+                }
+            }
+            Node* prev = idx.towers[t].node;
+            Node* p = (prev == nullptr) ? head : prev->next;
+            while (p != nullptr && p->elem() < key) {
+                prev = p;
+                p = p->next;
+            }
+            return prev;
+        }
+
+        // true when looking up each of `shorter` elements by index or
+        // exponential search beats walking all of `longer` elements
+        static bool gallops(size_type shorter, size_type longer) {
+            return static_cast<std::size_t>(shorter) * std::bit_width(static_cast<std::size_t>(longer)) < longer;
+        }
+
+        // First node not less than key after from, whose element is less
+        // than key: compares at 1, 2, 4, ... nodes ahead until it overshoots,
+        // then halves the last step.
+        static Node* seek_forward(Node* from, const T& key) {
+            Node* lo = from;        // lo->elem() < key throughout
+            std::size_t span = 0;   // the answer is within span nodes after lo
+            for (std::size_t step = 1; span == 0; step *= 2) {
+                Node* probe = lo;
+                std::size_t taken = 0;
+                while (taken < step && probe->next != nullptr) {
+                    probe = probe->next;
+                    taken++;
+                }
+                if (!(probe->elem() < key)) {
+                    span = taken;
+                } else if (probe->next == nullptr) {
+                    return nullptr;
+                } else {
+                    lo = probe;
+                }
+            }
+            while (span > 1) {
+                std::size_t half = span / 2;
+                Node* mid = lo;
+                for (std::size_t i = 0; i < half; ++i) {
+                    mid = mid->next;
+                }
+                if (mid->elem() < key) {
+                    lo = mid;
+                    span -= half;
+                } else {
+                    span = half;
+                }
+            }
+            return lo->next;
+        }
+
+        // Moves q (a node of this list, or nullptr for the end) to the first
+        // element not less than key; if that element equals key, steps past
+        // it and returns true. q only moves forward, so each element of this
+        // list pairs up with at most one key.
+        bool take_match(Node*& q, const T& key, bool gallop) const {
+            if (gallop && q != nullptr && q->elem() < key) {
+                q = index != nullptr ? node_before(key)->next : seek_forward(q, key);
+            }
+            while (q != nullptr && q->elem() < key) {
+                q = q->next;
+            }
+            if (q == nullptr || key < q->elem()) {
+                return false;
+            }
+            q = q->next;
+            return true;
+        }
+
+        // Appends copies to an empty list, taking the nodes from one slab
+        // sized for the most the caller can append; unused slots go back to
+        // the pool.
+        class BulkAppender {
+            private:
+                SinglyLinkedList& list;
+                Node* slots;
+                std::size_t capacity;
+                std::size_t used{0};
+
+            public:
+                BulkAppender(SinglyLinkedList& l, std::size_t n)
+                : list(l), slots(l.pool.bulk(n)), capacity(n) {}
+                BulkAppender(const BulkAppender&) = delete;
+                BulkAppender& operator=(const BulkAppender&) = delete;
+                ~BulkAppender() {
+                    for (std::size_t i = used; i < capacity; ++i) {
+                        list.pool.deallocate(slots + i);
+                    }
+                }
+
+                void push_back(const T& elem) {
+                    Node* node = std::construct_at(slots + used, elem);
+                    used++;
+                    (list.tail == nullptr ? list.head : list.tail->next) = node;
+                    list.tail = node;
+                    list.sz++;
+                }
+        };
+
+        // frees the chain built by remove_if() or unique()
+        void finish_removal(Node* removed, Node** removed_end, size_type count) {
+            if (count == 0) {
+                return;
+            }
+            *removed_end = nullptr;
+            sz -= count;
+            if (sz == 0) {
+                tail = nullptr;
+            }
+            drop_index();
+            release_chain(removed);
+        }
+
         // presumes valid empty list when called
         void clone(const SinglyLinkedList& other) {
             if (other.head == nullptr) {
@@ -267,22 +1192,114 @@ class SinglyLinkedList {
             }
             Node* current = other.head;
             while (current != nullptr) {
-                push_back(current->elem);
+                push_back(current->elem());
                 current = current->next;
             }
         }
 
+        // makes this list a copy of other, reusing existing nodes
+        void assign_from(const SinglyLinkedList& other) {
+            drop_index();
+            Node* src = other.head;
+            Node* dst = head;
+            Node* last = nullptr;   // last node overwritten
+            while (src != nullptr && dst != nullptr) {
+                dst->elem() = src->elem();
+                last = dst;
+                src = src->next;
+                dst = dst->next;
+            }
+
+            if (dst != nullptr) {
+                // other is shorter: cut off and free the rest
+                if (last == nullptr) {
+                    head = nullptr;
+                } else {
+                    last->next = nullptr;
+                }
+                tail = last;
+                release_chain(dst);
+                sz = other.sz;
+            }
+            for (; src != nullptr; src = src->next) {
+                push_back(src->elem());
+            }
+        }
+
     public:
+        // Non-destructive set operations (see set_union() above): the result
+        // is a new list and a and b are unchanged.
+        friend SinglyLinkedList set_union(const SinglyLinkedList& a, const SinglyLinkedList& b) {
+            if (union_size(a, b) > max_size()) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+            SinglyLinkedList out;
+            BulkAppender append(out, std::size_t{a.sz} + b.sz);
+            const Node* p = a.head;
+            const Node* q = b.head;
+            while (p != nullptr && q != nullptr) {
+                if (q->elem() < p->elem()) {
+                    append.push_back(q->elem());
+                    q = q->next;
+                } else {
+                    if (!(p->elem() < q->elem())) {
+                        q = q->next;   // paired with p
+                    }
+                    append.push_back(p->elem());
+                    p = p->next;
+                }
+            }
+            for (; p != nullptr; p = p->next) {
+                append.push_back(p->elem());
+            }
+            for (; q != nullptr; q = q->next) {
+                append.push_back(q->elem());
+            }
+            return out;
+        }
+
+        friend SinglyLinkedList set_intersection(const SinglyLinkedList& a, const SinglyLinkedList& b) {
+            const SinglyLinkedList& shorter = (b.sz < a.sz) ? b : a;
+            const SinglyLinkedList& longer = (b.sz < a.sz) ? a : b;
+            SinglyLinkedList out;
+            BulkAppender append(out, shorter.sz);
+            Node* q = longer.head;
+            const bool gallop = gallops(shorter.sz, longer.sz);
+            for (const Node* p = shorter.head; p != nullptr && q != nullptr; p = p->next) {
+                if (longer.take_match(q, p->elem(), gallop)) {
+                    append.push_back(p->elem());
+                }
+            }
+            return out;
+        }
+
+        friend SinglyLinkedList set_difference(const SinglyLinkedList& a, const SinglyLinkedList& b) {
+            SinglyLinkedList out;
+            BulkAppender append(out, a.sz);
+            Node* q = b.head;
+            const bool gallop = gallops(a.sz, b.sz);
+            for (const Node* p = a.head; p != nullptr; p = p->next) {
+                if (!b.take_match(q, p->elem(), gallop)) {
+                    append.push_back(p->elem());
+                }
+            }
+            return out;
+        }
+
         // non-member function to swap two lists
         friend void swap(SinglyLinkedList& a, SinglyLinkedList& b) {
             using std::swap;
             swap(a.head, b.head);
             swap(a.tail, b.tail);
             swap(a.sz, b.sz);
+            swap(a.index, b.index);
+            swap(a.compaction, b.compaction);
+            swap(a.pool, b.pool);
         }
 
         /// resets the list to empty
         void clear() {
+            drop_index();
             while(!empty()) {
                 pop_front();
             }
@@ -298,18 +1315,19 @@ class SinglyLinkedList {
             clone(other);
         }
 
-        /// copy assignment
+        /// copy assignment: copy-assigns into the nodes we already have and
+        /// only allocates or frees the difference in size
         SinglyLinkedList& operator=(const SinglyLinkedList& other) {
             if (this != &other) {
-                clear();
-                clone(other);
+                assign_from(other);
             }
             return *this;
         }
 
         /// move constructor
         SinglyLinkedList(SinglyLinkedList&& other) 
-            : sz(other.sz), head(other.head), tail(other.tail)
+            : sz(other.sz), head(other.head), tail(other.tail), pool(std::move(other.pool)),
+              index(std::move(other.index)), compaction(std::move(other.compaction))
              {
                 other.head = nullptr;
                 other.tail = nullptr;
@@ -325,6 +1343,10 @@ class SinglyLinkedList {
                 head = other.head;
                 tail = other.tail;
                 sz = other.sz;
+                index = std::move(other.index);
+                compaction.reset();   // its slab went with our nodes
+                compaction = std::move(other.compaction);
+                pool = std::move(other.pool);
 
                 // null the others
                 other.head = nullptr;
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>   // provides std::exception_ptr
+#include <optional>
+#include <utility>     // provides std::move
+#include <vector>
+
+#include "doubly_linked.hpp"
+
+namespace dsa::timer {
+
+// Hierarchical hashed timing wheel.
+// Four wheels of 256 slots each cover delays up to 2^32 ticks. Every slot is a
+// DoublyLinkedList bucket of timers. A timer goes into the wheel whose slot
+// width fits its remaining delay; when a lower wheel wraps, the next slot of
+// the wheel above is cascaded down, splicing its nodes without allocating.
+// Each tick the due level-0 slot is swapped out whole in O(1) and its timers
+// fired from there.
+//
+// schedule() and cancel() are O(1). Every handle remembers its timer's bucket
+// and node, so cancelling unlinks the node at once: memory follows the number
+// of pending timers, not how many were cancelled. Payloads live with the
+// handles, so Payload only needs to be move constructible.
+template <typename Payload>
+class TimerWheel {
+    public:
+        // identifies a scheduled timer: handle index in the low 32 bits,
+        // generation in the high 32 bits so stale ids never match
+        using TimerId = std::uint64_t;
+
+    private:
+        static constexpr int levels = 4;
+        static constexpr int slot_bits = 8;
+        static constexpr std::uint64_t slots = std::uint64_t{1} << slot_bits;
+        static constexpr std::uint64_t slot_mask = slots - 1;
+
+        struct Entry {
+            std::uint64_t expiry;
+            std::uint32_t handle;
+        };
+        using Bucket = dsa::list::DoublyLinkedList<Entry>;
+
+        // bucket number of a free handle
+        static constexpr std::uint32_t no_bucket = ~std::uint32_t{0};
+
+        struct Handle {
+            std::uint32_t generation{0};
+            std::uint32_t bucket{no_bucket};   // level * slots + slot while scheduled
+            typename Bucket::iterator node;
+            std::optional<Payload> payload;
+        };
+
+        std::array<std::array<Bucket, slots>, levels> wheels;
+        Bucket firing;                              // the due slot's timers while a tick fires them
+        std::uint32_t firing_bucket{no_bucket};     // the slot they came from; its number maps to firing
+        std::vector<Handle> handles;
+        std::vector<std::uint32_t> free_handles;
+        std::uint64_t now{0};
+        std::size_t active{0};
+
+        Bucket& bucket(std::uint32_t b) {
+            if (b == firing_bucket) {
+                return firing;
+            }
+            return wheels[b >> slot_bits][b & slot_mask];
+        }
+
+        TimerId id_of(std::uint32_t h) const {
+            return (static_cast<TimerId>(handles[h].generation) << 32) | h;
+        }
+
+        std::uint32_t acquire_handle() {
+            if (!free_handles.empty()) {
+                std::uint32_t h = free_handles.back();
+                free_handles.pop_back();
+                return h;
+            }
+            handles.emplace_back();
+            return static_cast<std::uint32_t>(handles.size() - 1);
+        }
+
+        // unlinks h's timer and recycles the handle
+        void release(std::uint32_t h) {
+            Handle& handle = handles[h];
+            bucket(handle.bucket).erase(handle.node);
+            handle.bucket = no_bucket;
+            handle.payload.reset();
+            handle.generation++;
+            free_handles.push_back(h);
+            active--;
+        }
+
+        std::uint32_t bucket_for(std::uint64_t expiry) const {
+            std::uint64_t delay = expiry - now;
+            int level = 0;
+            while (level < levels - 1 && delay >= (std::uint64_t{1} << (slot_bits * (level + 1)))) {
+                level++;
+            }
+            // beyond the top wheel's range, park in the furthest slot; it is re-placed on cascade
+            std::uint64_t at = (level == levels - 1 && (delay >> (slot_bits * levels)) != 0)
+                             ? now - 1 : expiry;
+            return static_cast<std::uint32_t>((level << slot_bits) | ((at >> (slot_bits * level)) & slot_mask));
+        }
+
+        // moves every timer of wheels[level][index] down to where it now belongs
+        void cascade(int level, std::uint64_t index) {
+            Bucket& from = wheels[level][index];
+            while (!from.empty()) {
+                auto node = from.begin();
+                std::uint32_t b = bucket_for(node->expiry);
+                Bucket& to = bucket(b);
+                to.splice(to.end(), from, node);
+                handles[node->handle].bucket = b;
+            }
+        }
+
+        template <typename Callback>
+        std::size_t tick_once(Callback& on_expire) {
+            now++;
+            // when wheels wrap, pull the next slot of each wrapped wheel above down,
+            // the highest first so its timers can land in the ones below
+            int top = 0;
+            while (top + 1 < levels && (now & ((std::uint64_t{1} << (slot_bits * (top + 1))) - 1)) == 0) {
+                top++;
+            }
+            for (int level = top; level >= 1; --level) {
+                cascade(level, (now >> (slot_bits * level)) & slot_mask);
+            }
+
+            // a timer scheduled from a callback is at least a tick away, so it
+            // never lands in the slot being emptied
+            std::uint32_t b = static_cast<std::uint32_t>(now & slot_mask);
+            Bucket& due = wheels[0][b];
+            if (due.empty()) {
+                return 0;
+            }
+            using std::swap;
+            swap(firing, due);
+            firing_bucket = b;
+            std::size_t fired = 0;
+            std::exception_ptr error;
+            try {
+                while (!firing.empty()) {
+                    std::uint32_t h = firing.front().handle;
+                    TimerId id = id_of(h);
+                    Payload payload = std::move(*handles[h].payload);
+                    release(h);
+                    fired++;
+                    try {
+                        on_expire(id, payload);
+                    } catch (...) {
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                }
+            } catch (...) {
+                swap(firing, due);   // moving a payload threw: put the unfired timers back
+                firing_bucket = no_bucket;
+                throw;
+            }
+            firing_bucket = no_bucket;
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return fired;
+        }
+
+    public:
+        TimerWheel() = default;
+
+        // handles point into this wheel's own buckets
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+        TimerWheel(TimerWheel&&) = default;
+        TimerWheel& operator=(TimerWheel&&) = default;
+
+        // current time in ticks
+        std::uint64_t time() const {
+            return now;
+        }
+
+        // number of timers scheduled and not yet fired or cancelled
+        std::size_t size() const {
+            return active;
+        }
+
+        bool empty() const {
+            return active == 0;
+        }
+
+        // Schedules payload to fire after delay ticks (a delay of 0 fires on the next tick)
+        TimerId schedule(std::uint64_t delay, Payload payload) {
+            if (delay == 0) {
+                delay = 1;
+            }
+            std::uint32_t h = acquire_handle();
+            std::uint64_t expiry = now + delay;
+            std::uint32_t b = bucket_for(expiry);
+            Handle& handle = handles[h];
+            try {
+                handle.payload.emplace(std::move(payload));
+                handle.node = bucket(b).insert(bucket(b).end(), Entry{expiry, h});
+            } catch (...) {
+                handle.payload.reset();
+                free_handles.push_back(h);
+                throw;
+            }
+            handle.bucket = b;
+            active++;
+            return id_of(h);
+        }
+
+        // Cancels a pending timer, freeing its node and payload at once;
+        // returns false if it already fired or was cancelled
+        bool cancel(TimerId id) {
+            std::uint32_t h = static_cast<std::uint32_t>(id);
+            if (h >= handles.size() || handles[h].generation != (id >> 32) || handles[h].bucket == no_bucket) {
+                return false;
+            }
+            release(h);
+            return true;
+        }
+
+        // Advances the clock by ticks, calling on_expire(id, payload) for every
+        // timer that comes due, in tick order. Returns how many fired.
+        // If on_expire throws, the rest of that tick's timers still fire, then
+        // the first exception is rethrown and the remaining ticks are not run.
+        // on_expire may schedule and cancel timers but must not call advance().
+        template <typename Callback>
+        std::size_t advance(std::uint64_t ticks, Callback on_expire) {
+            std::size_t fired = 0;
+            for (std::uint64_t i = 0; i < ticks; ++i) {
+                fired += tick_once(on_expire);
+            }
+            return fired;
+        }
+};
+
+}  // namespace dsa::timer
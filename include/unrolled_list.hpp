@@ -0,0 +1,492 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>     // provides std::memmove, std::memcpy
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>     // provides std::swap, std::exchange
+
+#include "node_pool.hpp"
+#include "simd_kernels.hpp"
+
+namespace dsa::list {
+
+// Unrolled doubly linked list: each node holds a block of up to BlockSize
+// elements stored contiguously, so there is one pointer chase per block and
+// find, count, contains, min, max and sum run the SIMD kernels of
+// simd_kernels.hpp over whole blocks.
+// Elements are moved within and between blocks with memmove, so T must be
+// trivially copyable. Inserting into a full block splits it in two; erasing
+// merges a block with its successor once both fit in half a block.
+// Inserting or erasing invalidates iterators into the blocks involved.
+template <typename T, std::size_t BlockSize = 64, std::unsigned_integral SizeType = std::size_t>
+class UnrolledList {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+                  "UnrolledList moves elements with memmove");
+    static_assert(BlockSize >= 2 && BlockSize <= (std::size_t{1} << 16), "BlockSize must be in [2, 65536]");
+
+    public:
+        using size_type = SizeType;
+        using sum_type = simd::sum_t<T>;
+
+    private:
+        class Block {
+            public:
+                Block* prev;
+                Block* next;
+                std::uint32_t count{0};
+                alignas(32) T elems[BlockSize];
+
+                Block(Block* prv, Block* nxt)
+                : prev{prv}, next{nxt} {}
+        };
+
+        SizeType sz{0};
+        Block* head{nullptr};
+        Block* tail{nullptr};
+        NodePool<Block> pool;  // where blocks are allocated and freed
+
+        // links a new, empty block after prev (nullptr: at the front)
+        Block* insert_block_after(Block* prev) {
+            Block* next = (prev == nullptr) ? head : prev->next;
+            Block* b = pool.create(prev, next);
+            (prev == nullptr ? head : prev->next) = b;
+            (next == nullptr ? tail : next->prev) = b;
+            return b;
+        }
+
+        void unlink_block(Block* b) {
+            (b->prev == nullptr ? head : b->prev->next) = b->next;
+            (b->next == nullptr ? tail : b->next->prev) = b->prev;
+            pool.destroy(b);
+        }
+
+        // opens a gap at index i of b (which has room)
+        static void open_gap(Block* b, std::size_t i) {
+            std::memmove(b->elems + i + 1, b->elems + i, (b->count - i) * sizeof(T));
+            b->count++;
+        }
+
+        // closes the gap left by removing index i of b
+        static void close_gap(Block* b, std::size_t i) {
+            std::memmove(b->elems + i, b->elems + i + 1, (b->count - i - 1) * sizeof(T));
+            b->count--;
+        }
+
+        // throws std::length_error unless n more elements fit in size_type
+        void check_room(std::size_t n = 1) const {
+            if (n > static_cast<std::size_t>(max_size() - sz)) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+        }
+
+        // presumes valid empty list when called
+        void clone(const UnrolledList& other) {
+            for (Block* src = other.head; src != nullptr; src = src->next) {
+                Block* b = insert_block_after(tail);
+                std::memcpy(b->elems, src->elems, src->count * sizeof(T));
+                b->count = src->count;
+            }
+            sz = other.sz;
+        }
+
+    public:
+        // Constructs an empty list
+        UnrolledList() = default;
+
+        size_type size() const {
+            return sz;
+        }
+
+        // largest size the size type can count; growing past it throws
+        // std::length_error
+        static constexpr size_type max_size() {
+            return std::numeric_limits<size_type>::max();
+        }
+
+        bool empty() const {
+            return sz == 0;
+        }
+
+        T& front() {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return head->elems[0];
+        }
+
+        const T& front() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return head->elems[0];
+        }
+
+        T& back() {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return tail->elems[tail->count - 1];
+        }
+
+        const T& back() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return tail->elems[tail->count - 1];
+        }
+
+        void push_back(const T& elem) {
+            check_room();
+            if (tail == nullptr || tail->count == BlockSize) {
+                insert_block_after(tail);
+            }
+            tail->elems[tail->count++] = elem;
+            sz++;
+        }
+
+        void push_front(const T& elem) {
+            check_room();
+            if (head == nullptr || head->count == BlockSize) {
+                insert_block_after(nullptr);
+            }
+            open_gap(head, 0);
+            head->elems[0] = elem;
+            sz++;
+        }
+
+        void pop_back() {
+            if (empty()) {
+                return;
+            }
+            if (--tail->count == 0) {
+                unlink_block(tail);
+            }
+            sz--;
+        }
+
+        void pop_front() {
+            if (empty()) {
+                return;
+            }
+            close_gap(head, 0);
+            if (head->count == 0) {
+                unlink_block(head);
+            }
+            sz--;
+        }
+
+        // Iterators are a block and an index into it. end() is one past the
+        // last element of the tail block.
+        class iterator {
+            // needed for UnrolledList's insert and erase
+            friend class UnrolledList;
+
+            private:
+                Block* block;
+                std::size_t idx;
+
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                iterator(Block* b = nullptr, std::size_t i = 0)
+                : block(b), idx(i) {}
+
+                T& operator*() const {
+                    return block->elems[idx];
+                }
+                T* operator->() const {
+                    return &(block->elems[idx]);
+                }
+                iterator& operator++() {
+                    if (++idx == block->count && block->next != nullptr) {
+                        block = block->next;
+                        idx = 0;
+                    }
+                    return *this;
+                }
+                iterator operator++(int) {
+                    iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                iterator& operator--() {
+                    if (idx == 0) {
+                        block = block->prev;
+                        idx = block->count;
+                    }
+                    --idx;
+                    return *this;
+                }
+                iterator operator--(int) {
+                    iterator old = *this;
+                    --(*this);
+                    return old;
+                }
+                bool operator==(iterator rhs) const {
+                    return block == rhs.block && idx == rhs.idx;
+                }
+                bool operator!=(iterator rhs) const {
+                    return !(*this == rhs);
+                }
+        };
+
+        class const_iterator {
+            private:
+                const Block* block;
+                std::size_t idx;
+
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                const_iterator(const Block* b = nullptr, std::size_t i = 0)
+                : block(b), idx(i) {}
+
+                const T& operator*() const {
+                    return block->elems[idx];
+                }
+                const T* operator->() const {
+                    return &(block->elems[idx]);
+                }
+                const_iterator& operator++() {
+                    if (++idx == block->count && block->next != nullptr) {
+                        block = block->next;
+                        idx = 0;
+                    }
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                const_iterator& operator--() {
+                    if (idx == 0) {
+                        block = block->prev;
+                        idx = block->count;
+                    }
+                    --idx;
+                    return *this;
+                }
+                const_iterator operator--(int) {
+                    const_iterator old = *this;
+                    --(*this);
+                    return old;
+                }
+                bool operator==(const_iterator rhs) const {
+                    return block == rhs.block && idx == rhs.idx;
+                }
+                bool operator!=(const_iterator rhs) const {
+                    return !(*this == rhs);
+                }
+        };
+
+        iterator begin() {
+            return iterator(head, 0);
+        }
+
+        const_iterator begin() const {
+            return const_iterator(head, 0);
+        }
+
+        iterator end() {
+            return iterator(tail, tail == nullptr ? 0 : tail->count);
+        }
+
+        const_iterator end() const {
+            return const_iterator(tail, tail == nullptr ? 0 : tail->count);
+        }
+
+        // Inserts elem before pos and returns an iterator to it
+        iterator insert(iterator pos, const T& elem) {
+            if (pos == end()) {
+                push_back(elem);
+                return iterator(tail, tail->count - 1);
+            }
+            check_room();
+            Block* b = pos.block;
+            std::size_t i = pos.idx;
+            if (b->count == BlockSize) {
+                // split: the upper half moves to a new block after b
+                Block* upper = insert_block_after(b);
+                std::size_t half = BlockSize / 2;
+                upper->count = static_cast<std::uint32_t>(BlockSize - half);
+                std::memcpy(upper->elems, b->elems + half, upper->count * sizeof(T));
+                b->count = static_cast<std::uint32_t>(half);
+                if (i > half) {
+                    b = upper;
+                    i -= half;
+                }
+            }
+            open_gap(b, i);
+            b->elems[i] = elem;
+            sz++;
+            return iterator(b, i);
+        }
+
+        // Erases the element at pos and returns an iterator to the one after it
+        iterator erase(iterator pos) {
+            if (empty() || pos == end()) {
+                throw std::runtime_error("Can't erase end() iterator");
+            }
+            Block* b = pos.block;
+            std::size_t i = pos.idx;
+            close_gap(b, i);
+            sz--;
+            if (b->count == 0) {
+                Block* next = b->next;
+                unlink_block(b);
+                return next == nullptr ? end() : iterator(next, 0);
+            }
+            Block* next = b->next;
+            if (next != nullptr && b->count + next->count <= BlockSize / 2) {
+                std::memcpy(b->elems + b->count, next->elems, next->count * sizeof(T));
+                b->count += next->count;
+                unlink_block(next);
+            }
+            if (i < b->count) {
+                return iterator(b, i);
+            }
+            return b->next == nullptr ? end() : iterator(b->next, 0);
+        }
+
+        // ---- SIMD kernels, one call per block
+
+        // Iterator to the first element equal to value, or end()
+        iterator find(const T& value) {
+            for (Block* b = head; b != nullptr; b = b->next) {
+                std::size_t i = simd::find(b->elems, b->count, value);
+                if (i < b->count) {
+                    return iterator(b, i);
+                }
+            }
+            return end();
+        }
+
+        const_iterator find(const T& value) const {
+            for (const Block* b = head; b != nullptr; b = b->next) {
+                std::size_t i = simd::find(b->elems, b->count, value);
+                if (i < b->count) {
+                    return const_iterator(b, i);
+                }
+            }
+            return end();
+        }
+
+        bool contains(const T& value) const {
+            return find(value) != end();
+        }
+
+        // number of elements equal to value
+        size_type count(const T& value) const {
+            size_type c = 0;
+            for (const Block* b = head; b != nullptr; b = b->next) {
+                c += static_cast<size_type>(simd::count(b->elems, b->count, value));
+            }
+            return c;
+        }
+
+        // smallest element; throws if the list is empty
+        T min() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            T best = simd::min(head->elems, head->count);
+            for (const Block* b = head->next; b != nullptr; b = b->next) {
+                T m = simd::min(b->elems, b->count);
+                if (m < best) {
+                    best = m;
+                }
+            }
+            return best;
+        }
+
+        // largest element; throws if the list is empty
+        T max() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            T best = simd::max(head->elems, head->count);
+            for (const Block* b = head->next; b != nullptr; b = b->next) {
+                T m = simd::max(b->elems, b->count);
+                if (best < m) {
+                    best = m;
+                }
+            }
+            return best;
+        }
+
+        // sum of all elements; integers are summed in 64 bits (see simd::sum_t)
+        sum_type sum() const {
+            sum_type total{};
+            for (const Block* b = head; b != nullptr; b = b->next) {
+                if constexpr (std::is_integral_v<sum_type>) {
+                    // wraps like the kernels do
+                    using U = std::make_unsigned_t<sum_type>;
+                    total = static_cast<sum_type>(static_cast<U>(total) + static_cast<U>(simd::sum(b->elems, b->count)));
+                } else {
+                    total += simd::sum(b->elems, b->count);
+                }
+            }
+            return total;
+        }
+
+        // non-member function to swap two lists
+        friend void swap(UnrolledList& a, UnrolledList& b) {
+            using std::swap;
+            swap(a.head, b.head);
+            swap(a.tail, b.tail);
+            swap(a.sz, b.sz);
+            swap(a.pool, b.pool);
+        }
+
+        // Resets the list to empty
+        void clear() {
+            while (head != nullptr) {
+                unlink_block(head);
+            }
+            sz = 0;
+        }
+
+        UnrolledList(const UnrolledList& other) {
+            clone(other);
+        }
+
+        UnrolledList& operator=(const UnrolledList& other) {
+            if (this != &other) {
+                clear();
+                clone(other);
+            }
+            return *this;
+        }
+
+        UnrolledList(UnrolledList&& other)
+        : sz(std::exchange(other.sz, 0)), head(std::exchange(other.head, nullptr)),
+          tail(std::exchange(other.tail, nullptr)), pool(std::move(other.pool)) {}
+
+        UnrolledList& operator=(UnrolledList&& other) {
+            if (this != &other) {
+                clear();
+                swap(*this, other);
+            }
+            return *this;
+        }
+
+        ~UnrolledList() {
+            clear();
+        }
+};
+
+}  // namespace dsa::list
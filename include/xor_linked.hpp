@@ -0,0 +1,367 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>     // provides std::swap, std::exchange
+
+#include "node_pool.hpp"
+
+namespace dsa::list {
+
+// XOR-linked doubly linked list.
+// Each node stores prev ^ next in a single link word, so a node costs one
+// pointer less than in DoublyLinkedList. The price is that a node alone doesn't
+// tell you its neighbours: iterators carry the previous node along with the
+// current one, and there is no erase or insert at an arbitrary iterator.
+// Both ends, reverse() and concatenate() are O(1).
+// SizeType counts the elements; std::uint32_t saves space for lists that stay small
+template <typename T, std::unsigned_integral SizeType = std::size_t>
+class XorLinkedList {
+    public:
+        using size_type = SizeType;
+
+    private:
+        class Node {
+            public:
+                std::uintptr_t link;   // address of prev ^ address of next
+                T elem;
+
+                Node(const T& element, std::uintptr_t lnk)
+                : link{lnk}, elem{element} {}
+        };
+
+        static std::uintptr_t addr(const Node* p) {
+            return reinterpret_cast<std::uintptr_t>(p);
+        }
+
+        // the neighbour of node on the other side from other
+        static Node* other_side(const Node* node, const Node* other) {
+            return reinterpret_cast<Node*>(node->link ^ addr(other));
+        }
+
+        SizeType sz{0};
+        Node* head{nullptr};
+        Node* tail{nullptr};
+        NodePool<Node> pool;  // where nodes are allocated and freed
+
+        // throws std::length_error unless n more elements fit in size_type
+        void check_room(std::size_t n = 1) const {
+            if (n > static_cast<std::size_t>(max_size() - sz)) {
+                throw std::length_error("List size would exceed max_size()");
+            }
+        }
+
+        // presumes valid empty list when called
+        void clone(const XorLinkedList& other) {
+            for (const T& elem : other) {
+                push_back(elem);
+            }
+        }
+
+    public:
+        // Constructs an empty list
+        XorLinkedList() = default;
+
+        size_type size() const {
+            return sz;
+        }
+
+        // largest size the size type can count; growing past it throws
+        // std::length_error
+        static constexpr size_type max_size() {
+            return std::numeric_limits<size_type>::max();
+        }
+
+        bool empty() const {
+            return sz == 0;
+        }
+
+        T& front() {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return head->elem;
+        }
+
+        const T& front() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return head->elem;
+        }
+
+        T& back() {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return tail->elem;
+        }
+
+        const T& back() const {
+            if (empty()) {
+                throw std::runtime_error("Empty List");
+            }
+            return tail->elem;
+        }
+
+        void push_front(const T& elem) {
+            check_room();
+            Node* new_node = pool.create(elem, addr(head));
+            if (head == nullptr) {
+                tail = new_node;
+            } else {
+                head->link ^= addr(new_node);
+            }
+            head = new_node;
+            sz++;
+        }
+
+        void push_back(const T& elem) {
+            check_room();
+            Node* new_node = pool.create(elem, addr(tail));
+            if (tail == nullptr) {
+                head = new_node;
+            } else {
+                tail->link ^= addr(new_node);
+            }
+            tail = new_node;
+            sz++;
+        }
+
+        void pop_front() {
+            if (empty()) {
+                return;
+            }
+            Node* old_head = head;
+            head = other_side(old_head, nullptr);
+            if (head == nullptr) {
+                tail = nullptr;
+            } else {
+                head->link ^= addr(old_head);
+            }
+            pool.destroy(old_head);
+            sz--;
+        }
+
+        void pop_back() {
+            if (empty()) {
+                return;
+            }
+            Node* old_tail = tail;
+            tail = other_side(old_tail, nullptr);
+            if (tail == nullptr) {
+                head = nullptr;
+            } else {
+                tail->link ^= addr(old_tail);
+            }
+            pool.destroy(old_tail);
+            sz--;
+        }
+
+        // Reverses the list in O(1): the links read the same in both directions
+        void reverse() {
+            std::swap(head, tail);
+        }
+
+        // Attaches the contents of M to the end of this list and clears M.
+        // No nodes are copied or allocated; only the two meeting links change.
+        void concatenate(XorLinkedList& M) {
+            if (this == &M || M.empty()) {
+                return;
+            }
+            check_room(M.sz);
+            pool.adopt(M.pool);   // M's nodes may live in its slabs
+            if (empty()) {
+                head = M.head;
+            } else {
+                tail->link ^= addr(M.head);
+                M.head->link ^= addr(tail);
+            }
+            tail = M.tail;
+            sz += M.sz;
+            M.head = nullptr;
+            M.tail = nullptr;
+            M.sz = 0;
+        }
+
+        // Iterators hold the current node and the one before it, which is all
+        // that's needed to step either way. end() is one past the tail.
+        // Pushing or popping next to an iterator's nodes invalidates it.
+        class iterator {
+            private:
+                Node* prev_ptr;   // node before the current one, nullptr at begin()
+                Node* node_ptr;   // current node, nullptr at end()
+
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                iterator(Node* prev = nullptr, Node* node = nullptr)
+                : prev_ptr(prev), node_ptr(node) {}
+
+                T& operator*() const {
+                    return node_ptr->elem;
+                }
+                T* operator->() const {
+                    return &(node_ptr->elem);
+                }
+                iterator& operator++() {
+                    Node* next = other_side(node_ptr, prev_ptr);
+                    prev_ptr = node_ptr;
+                    node_ptr = next;
+                    return *this;
+                }
+                iterator operator++(int) {
+                    iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                iterator& operator--() {
+                    Node* before = other_side(prev_ptr, node_ptr);
+                    node_ptr = prev_ptr;
+                    prev_ptr = before;
+                    return *this;
+                }
+                iterator operator--(int) {
+                    iterator old = *this;
+                    --(*this);
+                    return old;
+                }
+                bool operator==(iterator rhs) const {
+                    return node_ptr == rhs.node_ptr && prev_ptr == rhs.prev_ptr;
+                }
+                bool operator!=(iterator rhs) const {
+                    return !(*this == rhs);
+                }
+        };
+
+        class const_iterator {
+            private:
+                const Node* prev_ptr;
+                const Node* node_ptr;
+
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                const_iterator(const Node* prev = nullptr, const Node* node = nullptr)
+                : prev_ptr(prev), node_ptr(node) {}
+
+                const T& operator*() const {
+                    return node_ptr->elem;
+                }
+                const T* operator->() const {
+                    return &(node_ptr->elem);
+                }
+                const_iterator& operator++() {
+                    const Node* next = other_side(node_ptr, prev_ptr);
+                    prev_ptr = node_ptr;
+                    node_ptr = next;
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator old = *this;
+                    ++(*this);
+                    return old;
+                }
+                const_iterator& operator--() {
+                    const Node* before = other_side(prev_ptr, node_ptr);
+                    node_ptr = prev_ptr;
+                    prev_ptr = before;
+                    return *this;
+                }
+                const_iterator operator--(int) {
+                    const_iterator old = *this;
+                    --(*this);
+                    return old;
+                }
+                bool operator==(const_iterator rhs) const {
+                    return node_ptr == rhs.node_ptr && prev_ptr == rhs.prev_ptr;
+                }
+                bool operator!=(const_iterator rhs) const {
+                    return !(*this == rhs);
+                }
+        };
+
+        iterator begin() {
+            return iterator(nullptr, head);
+        }
+
+        const_iterator begin() const {
+            return const_iterator(nullptr, head);
+        }
+
+        iterator end() {
+            return iterator(tail, nullptr);
+        }
+
+        const_iterator end() const {
+            return const_iterator(tail, nullptr);
+        }
+
+        // non-member function to swap two lists
+        friend void swap(XorLinkedList& a, XorLinkedList& b) {
+            using std::swap;
+            swap(a.head, b.head);
+            swap(a.tail, b.tail);
+            swap(a.sz, b.sz);
+            swap(a.pool, b.pool);
+        }
+
+        // Resets the list to empty
+        void clear() {
+            while (!empty()) {
+                pop_front();
+            }
+        }
+
+        XorLinkedList(const XorLinkedList& other) {
+            clone(other);
+        }
+
+        // Copy-assigns into the nodes we already have and only allocates or
+        // frees the difference in size
+        XorLinkedList& operator=(const XorLinkedList& other) {
+            if (this != &other) {
+                const_iterator src = other.begin();
+                for (iterator dst = begin(); src != other.end() && dst != end(); ++src, ++dst) {
+                    *dst = *src;
+                }
+                while (sz > other.sz) {
+                    pop_back();
+                }
+                for (; src != other.end(); ++src) {
+                    push_back(*src);
+                }
+            }
+            return *this;
+        }
+
+        XorLinkedList(XorLinkedList&& other)
+        : sz(std::exchange(other.sz, 0)), head(std::exchange(other.head, nullptr)),
+          tail(std::exchange(other.tail, nullptr)), pool(std::move(other.pool)) {}
+
+        XorLinkedList& operator=(XorLinkedList&& other) {
+            if (this != &other) {
+                clear();
+                swap(*this, other);
+            }
+            return *this;
+        }
+
+        ~XorLinkedList() {
+            clear();
+        }
+};
+
+}  // namespace dsa::list
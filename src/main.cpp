@@ -97,18 +97,15 @@ int main() {
     //If the size is odd, throw std::logic_error
     L.splitEven(A, B);
 
-    // use front as we have no begin/end
     std::cout << "A: ";
-    for (int i{0}; i < A.size(); i++) {
-        std::cout << A.front() << " ";
-        A.rotate();
+    for (int x : A) {
+        std::cout << x << " ";
     }
     std::cout << "\n";
 
     std::cout << "B: ";
-    for (int i{0}; i < B.size(); i++) {
-        std::cout << B.front() << " ";
-        B.rotate();
+    for (int x : B) {
+        std::cout << x << " ";
     }
     std::cout << "\n";
 
@@ -1,9 +1,36 @@
 // test_vector.cpp
 #define CATCH_CONFIG_MAIN
 #include "catch2/catch.hpp"
+#include "adjacency_list.hpp"
 #include "singly_linked.hpp"
 #include "doubly_linked.hpp"
 #include "circularly_linked.hpp"
+#include "cow_list.hpp"
+#include "immutable_list.hpp"
+#include "lru_cache.hpp"
+#include "parallel.hpp"
+#include "round_robin.hpp"
+#include "sharded_lru_cache.hpp"
+#include "timer_wheel.hpp"
+#include "unrolled_list.hpp"
+#include "xor_linked.hpp"
+#ifdef __linux__
+#include "mapped_list.hpp"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 
 TEST_CASE("SinglyLinkedList: Rever") {
@@ -94,4 +121,1949 @@ TEST_CASE("CircularlyLinkedList: splitEven") {
         main_list.push_back(7); // Make the list size odd (7)
         REQUIRE_THROWS_AS(main_list.splitEven(listA, listB), std::logic_error);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("parallel_for_each and parallel_reduce") {
+    dsa::list::SinglyLinkedList<long long> slist;
+    dsa::list::DoublyLinkedList<long long> dlist;
+    const long long n = 100000;
+    for (long long i = 1; i <= n; ++i) {
+        slist.push_back(i);
+        dlist.push_back(i);
+    }
+
+    SECTION("Reduce matches the serial sum") {
+        REQUIRE(dsa::list::parallel_reduce(slist, 0LL) == n * (n + 1) / 2);
+        REQUIRE(dsa::list::parallel_reduce(dlist, 0LL, std::plus<>{}, [](long long x) { return x * 2; }, 4)
+                == n * (n + 1));
+    }
+
+    SECTION("for_each visits every element exactly once") {
+        dsa::list::parallel_for_each(slist, [](long long& x) { x = -x; }, 8);
+        dsa::list::parallel_for_each(dlist, [](long long& x) { x += 1; }, 3);
+        REQUIRE(slist.front() == -1);
+        REQUIRE(slist.back() == -n);
+        REQUIRE(dsa::list::parallel_reduce(slist, 0LL) == -n * (n + 1) / 2);
+        REQUIRE(dsa::list::parallel_reduce(dlist, 0LL) == n * (n + 1) / 2 + n);
+    }
+
+    SECTION("Empty and tiny lists") {
+        dsa::list::SinglyLinkedList<int> empty;
+        REQUIRE(dsa::list::parallel_reduce(empty, 7) == 7);
+        dsa::list::DoublyLinkedList<int> one;
+        one.push_back(5);
+        REQUIRE(dsa::list::parallel_reduce(one, 1, std::multiplies<>{}, std::identity{}, 16) == 5);
+    }
+
+    SECTION("Exceptions reach the caller and nested calls finish") {
+        REQUIRE_THROWS_AS(dsa::list::parallel_for_each(slist, [](long long x) {
+            if (x == n / 2) {
+                throw std::runtime_error("bad element");
+            }
+        }, 4), std::runtime_error);
+
+        // chunks of one call run further parallel calls on the same pool
+        std::atomic<long long> total{0};
+        std::atomic<int> nested{0};
+        dsa::list::parallel_for_each(slist, [&](long long x) {
+            if (x % 10000 == 0) {
+                total += dsa::list::parallel_reduce(dlist, 0LL, std::plus<>{}, std::identity{}, 4);
+                nested++;
+            }
+        }, 8);
+        REQUIRE(nested == 10);
+        REQUIRE(total == 10 * (n * (n + 1) / 2));
+    }
+}
+
+TEST_CASE("SinglyLinkedList: skip index") {
+    dsa::list::SinglyLinkedList<int> list;
+
+    SECTION("insert_sorted keeps order and at() finds every position") {
+        for (int i = 0; i < 2000; ++i) {
+            list.insert_sorted((i * 7919) % 1000);   // every value twice, shuffled
+        }
+        REQUIRE(list.size() == 2000);
+        int prev = -1;
+        int k = 0;
+        for (int x : list) {
+            REQUIRE(prev <= x);
+            REQUIRE(list.at(k) == x);
+            prev = x;
+            ++k;
+        }
+        REQUIRE(list.at(0) == 0);
+        REQUIRE(list.at(1999) == 999);
+        REQUIRE_THROWS_AS(list.at(2000), std::out_of_range);
+    }
+
+    SECTION("lower_bound on a list built with push_back") {
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(2 * i);
+        }
+        REQUIRE(*list.lower_bound(0) == 0);
+        REQUIRE(*list.lower_bound(501) == 502);
+        REQUIRE(*list.lower_bound(1998) == 1998);
+        REQUIRE(list.lower_bound(1999) == list.end());
+    }
+
+    SECTION("const lookups from several threads after build_index") {
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(2 * i);
+        }
+        list.build_index();
+        const auto& shared = list;
+        std::atomic<int> wrong{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&shared, &wrong, t] {
+                for (int i = t; i < 1000; i += 4) {
+                    if (shared.at(static_cast<std::size_t>(i)) != 2 * i || *shared.lower_bound(2 * i - 1) != 2 * i) {
+                        wrong++;
+                    }
+                }
+            });
+        }
+        for (auto& r : readers) {
+            r.join();
+        }
+        REQUIRE(wrong == 0);
+    }
+
+    SECTION("index survives mixing with insert_after and erase_after") {
+        for (int i = 0; i < 100; ++i) {
+            list.push_back(i * 10);
+        }
+        REQUIRE(list.at(50) == 500);
+        auto it = list.lower_bound(500);
+        list.insert_after(it, 505);
+        REQUIRE(list.at(51) == 505);
+        list.erase_after(list.lower_bound(490));   // removes 500
+        REQUIRE(list.at(50) == 505);
+        auto pos = list.insert_sorted(503);
+        REQUIRE(*pos == 503);
+        list.erase_after(pos);                     // removes 505
+        REQUIRE(list.at(50) == 503);
+        REQUIRE(list.at(51) == 510);
+        REQUIRE(list.size() == 100);
+    }
+
+    SECTION("pushes, pops and edits in the middle keep the index in step") {
+        auto churn = [](auto& l, int ops, int cap) {
+            std::vector<int> model;
+            std::mt19937 rng(7);
+            for (int op = 0; op < ops; ++op) {
+                int value = op;
+                std::size_t k = model.empty() ? 0 : rng() % model.size();
+                switch (model.size() >= static_cast<std::size_t>(cap) ? 3 + rng() % 3 : rng() % 6) {
+                    case 0: l.push_front(value); model.insert(model.begin(), value); break;
+                    case 1: l.push_back(value); model.push_back(value); break;
+                    case 2:
+                        if (!model.empty()) {
+                            auto it = l.begin();
+                            std::advance(it, k);
+                            l.insert_after(it, value);
+                            model.insert(model.begin() + static_cast<std::ptrdiff_t>(k) + 1, value);
+                        }
+                        break;
+                    case 3: l.pop_front(); if (!model.empty()) model.erase(model.begin()); break;
+                    default:
+                        if (model.size() >= 2) {
+                            k %= model.size() - 1;
+                            auto it = l.begin();
+                            std::advance(it, k);
+                            l.erase_after(it);
+                            model.erase(model.begin() + static_cast<std::ptrdiff_t>(k) + 1);
+                        }
+                }
+                REQUIRE(l.size() == model.size());
+                if (!model.empty()) {
+                    std::size_t probe = rng() % model.size();
+                    REQUIRE(l.at(probe) == model[probe]);
+                    REQUIRE(l.at(model.size() - 1) == model.back());
+                }
+            }
+            std::size_t i = 0;
+            for (int x : l) {
+                REQUIRE(x == model[i++]);
+            }
+        };
+        churn(list, 5000, 1000);
+        dsa::list::SinglyLinkedList<int, std::uint8_t> small;   // end widths wrap at 256
+        churn(small, 3000, 255);
+    }
+}
+
+TEST_CASE("DoublyLinkedList: order index") {
+    dsa::list::DoublyLinkedList<int> list;
+    for (int i = 0; i < 5000; ++i) {
+        list.push_back(i);
+    }
+
+    auto check = [&list]() {
+        std::size_t k = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++k) {
+            REQUIRE(list.rank(it) == k);
+            REQUIRE(list.nth(k) == it);
+        }
+        REQUIRE(k == list.size());
+    };
+
+    SECTION("Without the index the same answers come from walking") {
+        REQUIRE(*list.nth(4321) == 4321);
+        REQUIRE(list.distance(list.nth(10), list.nth(4000)) == 3990);
+        REQUIRE(list.distance(list.nth(4000), list.nth(10)) == -3990);
+        REQUIRE(*list.advance(list.begin(), 17) == 17);
+        REQUIRE(list.advance(list.nth(4990), 10) == list.end());
+        REQUIRE_THROWS_AS(list.advance(list.begin(), -1), std::out_of_range);
+    }
+
+    SECTION("The index follows inserts, erases and concatenation") {
+        list.enable_order_index();
+        REQUIRE(list.has_order_index());
+        REQUIRE(*list.nth(4321) == 4321);
+        REQUIRE(list.distance(list.nth(4000), list.nth(10)) == -3990);
+
+        // grow one region until its blocks split
+        auto mid = list.nth(2500);
+        for (int i = 0; i < 600; ++i) {
+            mid = list.insert(mid, -i);
+        }
+        // erase across block boundaries
+        auto it = list.nth(100);
+        for (int i = 0; i < 700; ++i) {
+            it = list.erase(it);
+        }
+        list.push_front(-1);
+        list.pop_back();
+        REQUIRE(list.size() == 5000 + 600 - 700);
+        check();
+
+        dsa::list::DoublyLinkedList<int> other;
+        other.enable_order_index();
+        for (int i = 0; i < 300; ++i) {
+            other.push_front(i);
+        }
+        list.concatenate(other);
+        REQUIRE(*list.nth(list.size() - 1) == 0);
+        check();
+
+        while (list.size() > 10) {
+            list.pop_front();
+        }
+        check();
+        REQUIRE(*list.advance(list.end(), -10) == list.front());
+    }
+}
+
+TEST_CASE("Binary save and load") {
+    dsa::list::SinglyLinkedList<int> slist;
+    dsa::list::DoublyLinkedList<double> dlist;
+    dsa::list::CircularlyLinkedList<long> clist;
+    for (int i = 0; i < 100000; ++i) {
+        slist.push_back(i);
+        dlist.push_back(i * 0.5);
+        clist.push_back(-i);
+    }
+
+    SECTION("Round trip through a stream") {
+        std::stringstream sbuf, dbuf, cbuf;
+        slist.save(sbuf);
+        dlist.save(dbuf);
+        clist.save(cbuf);
+
+        dsa::list::SinglyLinkedList<int> s2;
+        dsa::list::DoublyLinkedList<double> d2;
+        dsa::list::CircularlyLinkedList<long> c2;
+        s2.push_back(42);   // replaced by load
+        s2.load(sbuf);
+        d2.load(dbuf);
+        c2.load(cbuf);
+
+        REQUIRE(s2.size() == 100000);
+        REQUIRE(s2.front() == 0);
+        REQUIRE(s2.back() == 99999);
+        REQUIRE(d2.size() == 100000);
+        REQUIRE(d2.back() == 49999.5);
+        REQUIRE(c2.size() == 100000);
+        REQUIRE(c2.front() == 0);
+        REQUIRE(c2.back() == -99999);
+
+        long long sum = 0;
+        for (int x : s2) {
+            sum += x;
+        }
+        REQUIRE(sum == 99999LL * 100000 / 2);
+
+        // loaded nodes are freed and reused like any others
+        s2.pop_front();
+        s2.push_front(-1);
+        d2.pop_back();
+        d2.push_back(1.0);
+        REQUIRE(s2.front() == -1);
+        REQUIRE(d2.back() == 1.0);
+
+        // nodes moved into another list stay valid after the loaded list is gone
+        dsa::list::SinglyLinkedList<int> target;
+        target.push_back(7);
+        {
+            dsa::list::SinglyLinkedList<int> loaded;
+            std::stringstream again;
+            slist.save(again);
+            loaded.load(again);
+            target.concatenate(loaded);
+        }
+        REQUIRE(target.size() == 100001);
+        REQUIRE(target.back() == 99999);
+
+        dsa::list::CircularlyLinkedList<long> a, b;
+        c2.splitEven(a, b);
+        c2 = dsa::list::CircularlyLinkedList<long>();
+        REQUIRE(a.front() == 0);
+        REQUIRE(b.back() == -99999);
+    }
+
+    SECTION("Round trip through a file descriptor") {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        int fd = fileno(file);
+        dlist.save(fd);
+        REQUIRE(lseek(fd, 0, SEEK_SET) == 0);
+        dsa::list::DoublyLinkedList<double> d2;
+        d2.load(fd);
+        std::fclose(file);
+        REQUIRE(d2.size() == dlist.size());
+        REQUIRE(d2.front() == 0.0);
+        REQUIRE(d2.back() == 49999.5);
+    }
+
+    SECTION("Malformed input throws and leaves the list alone") {
+        std::stringstream buf;
+        slist.save(buf);
+        std::string truncated = buf.str().substr(0, 1000);
+        std::stringstream in(truncated);
+        dsa::list::SinglyLinkedList<int> s2;
+        s2.push_back(5);
+        REQUIRE_THROWS_AS(s2.load(in), std::runtime_error);
+        REQUIRE(s2.size() == 1);
+        REQUIRE(s2.front() == 5);
+
+        std::stringstream wrong_type(buf.str());
+        dsa::list::SinglyLinkedList<double> s3;
+        REQUIRE_THROWS_AS(s3.load(wrong_type), std::runtime_error);
+
+        // an oversized count is rejected before anything is allocated for it
+        dsa::list::io::Header h{};
+        std::string bytes = buf.str();
+        std::memcpy(&h, bytes.data(), sizeof h);
+        h.count = std::uint64_t{1} << 60;
+        std::memcpy(bytes.data(), &h, sizeof h);
+        std::stringstream oversized(bytes);
+        REQUIRE_THROWS_AS(s2.load(oversized), std::runtime_error);
+        REQUIRE(s2.size() == 1);
+
+        // and through a pipe, which can't tell how much is left, it runs out of input
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+        REQUIRE(::write(fds[1], bytes.data(), 4096) == 4096);
+        ::close(fds[1]);
+        dsa::list::DoublyLinkedList<int> d3;
+        REQUIRE_THROWS_AS(d3.load(fds[0]), std::runtime_error);
+        ::close(fds[0]);
+        REQUIRE(d3.empty());
+    }
+}
+
+#ifdef __linux__
+TEST_CASE("MappedDoublyLinkedList: persistence") {
+    std::string path = "/tmp/dsa_mapped_list_" + std::to_string(::getpid()) + ".bin";
+    ::unlink(path.c_str());
+    using Mapped = dsa::list::MappedDoublyLinkedList<long>;
+
+    {
+        Mapped list(path);
+        REQUIRE(list.empty());
+        for (long i = 0; i < 10000; ++i) {   // grows the file several times
+            list.push_back(i);
+        }
+        list.push_front(-1);
+        list.pop_back();
+        auto it = list.begin();
+        ++it;
+        it = list.erase(it);                 // removes 0
+        list.insert(it, 100);                // reuses the freed node
+        list.sync();
+    }
+
+    {
+        Mapped list(path);
+        REQUIRE(list.size() == 10000);
+        REQUIRE(list.front() == -1);
+        REQUIRE(list.back() == 9998);
+        auto it = list.begin();
+        REQUIRE(*++it == 100);
+        REQUIRE(*++it == 1);
+
+        Mapped reader(path, Mapped::Mode::read_only);
+        REQUIRE(reader.size() == 10000);
+        REQUIRE_THROWS_AS(reader.push_back(5), std::logic_error);
+
+        for (long i = 0; i < 5000; ++i) {
+            list.push_back(i);
+        }
+        REQUIRE_THROWS_AS(reader.back(), std::runtime_error);   // past the reader's mapping
+        reader.refresh();
+        REQUIRE(reader.size() == 15000);
+        REQUIRE(reader.back() == 4999);
+        long count = 0;
+        for (auto r = reader.end(); r != reader.begin(); --r) {
+            count++;
+        }
+        REQUIRE(count == 15000);
+        list.clear();
+        REQUIRE(reader.empty());
+    }
+
+    REQUIRE_THROWS(Mapped("/tmp/dsa_mapped_list_missing_file.bin", Mapped::Mode::read_only));
+    REQUIRE_THROWS_AS(dsa::list::MappedDoublyLinkedList<char>(path), std::runtime_error);
+
+    // offsets and counts in the file header are checked against the file
+    auto corrupt_at = [&path](off_t field, std::uint64_t value) {
+        int fd = ::open(path.c_str(), O_WRONLY);
+        REQUIRE(fd >= 0);
+        REQUIRE(::pwrite(fd, &value, sizeof value, field) == static_cast<ssize_t>(sizeof value));
+        ::close(fd);
+    };
+    constexpr off_t size_field = 24, header_field = 48, trailer_field = 56;
+    std::uint64_t header_off = 0;
+    {
+        Mapped list(path);
+        list.push_back(1);
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        REQUIRE(f != nullptr);
+        REQUIRE(std::fseek(f, header_field, SEEK_SET) == 0);
+        REQUIRE(std::fread(&header_off, sizeof header_off, 1, f) == 1);
+        std::fclose(f);
+    }
+    corrupt_at(header_field, std::uint64_t{1} << 40);
+    REQUIRE_THROWS_AS(Mapped(path, Mapped::Mode::read_only), std::runtime_error);
+    corrupt_at(header_field, header_off + 1);
+    REQUIRE_THROWS_AS(Mapped(path), std::runtime_error);
+    corrupt_at(header_field, header_off);
+    corrupt_at(trailer_field, header_off);
+    REQUIRE_THROWS_AS(Mapped(path), std::runtime_error);
+    corrupt_at(trailer_field, header_off + 24);   // sizeof(Node) for long
+    corrupt_at(size_field, 1'000'000'000);
+    REQUIRE_THROWS_AS(Mapped(path), std::runtime_error);
+    corrupt_at(size_field, 1);
+    REQUIRE(Mapped(path).front() == 1);
+
+    // a damaged link between nodes is caught when it is followed, in either mode
+    std::uint64_t first_off = 0;
+    {
+        Mapped list(path);
+        list.push_back(2);
+        list.push_back(3);
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        REQUIRE(f != nullptr);
+        REQUIRE(std::fseek(f, static_cast<long>(header_off + 8), SEEK_SET) == 0);   // header's next
+        REQUIRE(std::fread(&first_off, sizeof first_off, 1, f) == 1);
+        std::fclose(f);
+    }
+    auto walk = [](const Mapped& list) {
+        long sum = 0;
+        for (long x : list) {
+            sum += x;
+        }
+        return sum;
+    };
+    corrupt_at(static_cast<off_t>(first_off + 8), std::uint64_t{1} << 40);
+    REQUIRE_THROWS_AS(walk(Mapped(path)), std::runtime_error);
+    REQUIRE_THROWS_AS(walk(Mapped(path, Mapped::Mode::read_only)), std::runtime_error);
+    corrupt_at(static_cast<off_t>(first_off + 8), first_off + 1);
+    REQUIRE_THROWS_AS(walk(Mapped(path)), std::runtime_error);
+    ::unlink(path.c_str());
+}
+#endif
+
+TEST_CASE("ImmutableList: versions share structure") {
+    using dsa::list::ImmutableList;
+    ImmutableList<int> empty;
+    ImmutableList<int> v1 = empty.push_front(1);
+    ImmutableList<int> v2 = v1.push_front(2);
+    ImmutableList<int> v3 = v2.push_front(3);
+    ImmutableList<int> branch = v2.push_front(30);
+
+    REQUIRE(empty.empty());
+    REQUIRE(v3.size() == 3);
+    REQUIRE(v3.front() == 3);
+    REQUIRE(branch.front() == 30);
+    REQUIRE(&*++branch.begin() == &*++v3.begin());   // same tail node
+
+    ImmutableList<int> copy = v3;
+    REQUIRE(copy.same(v3));
+    REQUIRE(copy.pop_front().same(v2));
+    REQUIRE(v2.pop_front().pop_front().pop_front().empty());
+
+    // old versions survive the newer ones
+    v3 = ImmutableList<int>();
+    branch = ImmutableList<int>();
+    int expected[] = {2, 1};
+    int i = 0;
+    for (int x : v2) {
+        REQUIRE(x == expected[i++]);
+    }
+    REQUIRE(i == 2);
+    REQUIRE_THROWS_AS(empty.front(), std::runtime_error);
+
+    SECTION("Built from a SinglyLinkedList and read generically") {
+        dsa::list::SinglyLinkedList<int> source;
+        for (int k = 1; k <= 10000; ++k) {
+            source.push_back(k);
+        }
+        ImmutableList<int> snapshot(source.begin(), source.end());
+        source.pop_front();
+        REQUIRE(snapshot.size() == 10000);
+        REQUIRE(snapshot.front() == 1);
+        REQUIRE(dsa::list::parallel_reduce(snapshot, 0LL) == 10000LL * 10001 / 2);
+
+        // dropping a long chain must not recurse
+        ImmutableList<int> longer;
+        for (int k = 0; k < 1000000; ++k) {
+            longer = longer.push_front(k);
+        }
+    }
+}
+
+TEST_CASE("CowDoublyLinkedList: copies share until written") {
+    dsa::list::CowDoublyLinkedList<int> original;
+    for (int i = 1; i <= 5; ++i) {
+        original.push_back(i);
+    }
+
+    dsa::list::CowDoublyLinkedList<int> copy = original;
+    REQUIRE(copy.shares_with(original));
+    REQUIRE(&copy.front() == &original.front());
+
+    copy.push_back(6);
+    REQUIRE_FALSE(copy.shares_with(original));
+    REQUIRE(copy.size() == 6);
+    REQUIRE(original.size() == 5);
+    REQUIRE(original.back() == 5);
+
+    // a sole owner mutates in place
+    const int* first = &copy.front();
+    copy.pop_back();
+    REQUIRE(&copy.front() == first);
+
+    dsa::list::CowDoublyLinkedList<int> third = original;
+    third.edit().front() = 100;
+    REQUIRE(third.front() == 100);
+    REQUIRE(original.front() == 1);
+
+    dsa::list::CowDoublyLinkedList<int> shared = original;
+    shared.clear();
+    REQUIRE(shared.empty());
+    REQUIRE(original.size() == 5);
+
+    dsa::list::CowDoublyLinkedList<int> tail = original;
+    copy.concatenate(tail);
+    REQUIRE(copy.size() == 10);
+    REQUIRE(tail.empty());
+    REQUIRE(original.size() == 5);
+
+    int sum = 0;
+    for (int x : original) {
+        sum += x;
+    }
+    REQUIRE(sum == 15);
+}
+
+TEST_CASE("LruCache: eviction order and counters") {
+    dsa::cache::LruCache<int, std::string> cache(3);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    REQUIRE(cache.size() == 3);
+
+    REQUIRE(*cache.get(1) == "one");      // 2 is now least recently used
+    std::string* evicted_slot = cache.get(2);
+    cache.get(3);
+    cache.get(1);                         // order: 1 3 2
+    cache.put(4, "four");                 // evicts 2 and reuses its entry
+    REQUIRE_FALSE(cache.contains(2));
+    REQUIRE(cache.get(4) == evicted_slot);
+    REQUIRE(cache.get(2) == nullptr);
+
+    cache.put(3, "THREE");                // update promotes; order: 3 4 1
+    cache.put(5, "five");                 // evicts 1
+    REQUIRE_FALSE(cache.contains(1));
+    REQUIRE(*cache.peek(3) == "THREE");
+
+    REQUIRE(cache.stats().hits == 5);
+    REQUIRE(cache.stats().misses == 1);
+    REQUIRE(cache.stats().evictions == 2);
+
+    REQUIRE(cache.erase(4));
+    REQUIRE_FALSE(cache.erase(4));
+    REQUIRE(cache.size() == 2);
+    cache.put(6, "six");
+    cache.put(7, "seven");                // evicts 3: peek() didn't refresh it
+    REQUIRE_FALSE(cache.contains(3));
+    REQUIRE(cache.contains(5));
+
+    cache.reset_stats();
+    REQUIRE(cache.stats().hits == 0);
+    REQUIRE_THROWS_AS((dsa::cache::LruCache<int, int>(0)), std::invalid_argument);
+
+    // a copy has its own entries and recency
+    dsa::cache::LruCache<int, std::string> copy(cache);
+    REQUIRE(copy.get(5) != cache.peek(5));
+    copy.put(8, "eight");                 // evicts 6 from the copy only
+    REQUIRE_FALSE(copy.contains(6));
+    REQUIRE(cache.contains(6));
+    REQUIRE_FALSE(cache.contains(8));
+    cache = copy;
+    REQUIRE(*cache.get(8) == "eight");
+    REQUIRE(cache.size() == 3);
+
+    // a moved-from cache is empty and still usable
+    const std::string* eight = cache.peek(8);
+    dsa::cache::LruCache<int, std::string> moved(std::move(cache));
+    REQUIRE(moved.peek(8) == eight);
+    REQUIRE(cache.empty());
+    cache.put(9, "nine");
+    REQUIRE(*cache.get(9) == "nine");
+    REQUIRE(cache.stats().hits == 1);
+    copy = std::move(moved);
+    REQUIRE(copy.peek(8) == eight);
+    REQUIRE(moved.empty());
+    REQUIRE(moved.get(8) == nullptr);
+    moved.put(1, "one");
+    REQUIRE(moved.size() == 1);
+}
+
+namespace {
+struct FragileValue {
+    static inline bool fail = false;
+    int v{0};
+
+    FragileValue(int x = 0) : v{x} {}
+    FragileValue(const FragileValue&) = default;
+    FragileValue& operator=(const FragileValue& other) {
+        if (fail) {
+            throw std::runtime_error("assignment failed");
+        }
+        v = other.v;
+        return *this;
+    }
+};
+}
+
+TEST_CASE("LruCache: a throwing value assignment leaves the cache consistent") {
+    dsa::cache::LruCache<int, FragileValue> cache(2);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    FragileValue::fail = true;
+    REQUIRE_THROWS_AS(cache.put(3, 30), std::runtime_error);   // 1 was being recycled
+    FragileValue::fail = false;
+    REQUIRE(cache.size() == 1);
+    REQUIRE_FALSE(cache.contains(1));
+    REQUIRE_FALSE(cache.contains(3));
+    REQUIRE(cache.get(2)->v == 20);
+    cache.put(3, 30);
+    cache.put(4, 40);                     // evicts 2
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.get(3)->v == 30);
+    REQUIRE(cache.get(4)->v == 40);
+}
+
+TEST_CASE("ShardedLruCache: sharding and lazy promotion") {
+    using Cache = dsa::cache::ShardedLruCache<int, int>;
+
+    SECTION("Behaves as a cache from one thread") {
+        Cache cache(64, 4);
+        for (int i = 0; i < 40; ++i) {
+            cache.put(i, i * i);
+        }
+        REQUIRE(cache.size() == 40);
+        REQUIRE(cache.get(7) == 49);
+        REQUIRE_FALSE(cache.get(1000).has_value());
+        REQUIRE(cache.erase(7));
+        REQUIRE_FALSE(cache.contains(7));
+        REQUIRE(cache.stats().hits == 1);
+        REQUIRE(cache.stats().misses == 1);
+        REQUIRE_THROWS_AS(Cache(2, 4), std::invalid_argument);
+    }
+
+    SECTION("Lazy hits are applied in batches") {
+        Cache cache(2, 1, Cache::Promotion::lazy, 8);
+        cache.put(1, 10);
+        cache.put(2, 20);
+        REQUIRE(cache.get(1) == 10);   // buffered: 1 is still least recently used
+        cache.flush();                 // now 2 is
+        cache.put(3, 30);
+        REQUIRE(cache.contains(1));
+        REQUIRE_FALSE(cache.contains(2));
+    }
+
+    SECTION("Concurrent readers and writers") {
+        for (auto mode : {Cache::Promotion::eager, Cache::Promotion::lazy}) {
+            Cache cache(1000, 8, mode);
+            std::atomic<int> wrong{0};   // Catch assertions aren't thread-safe
+            std::vector<std::thread> workers;
+            for (int t = 0; t < 4; ++t) {
+                workers.emplace_back([&cache, &wrong, t]() {
+                    for (int i = 0; i < 20000; ++i) {
+                        int key = (i * 31 + t) % 3000;
+                        if (auto hit = cache.get(key)) {
+                            wrong += (*hit != key * 2);
+                        } else {
+                            cache.put(key, key * 2);
+                        }
+                    }
+                    cache.flush();
+                });
+            }
+            for (auto& w : workers) {
+                w.join();
+            }
+            REQUIRE(wrong == 0);
+            REQUIRE(cache.size() <= 1000);
+            auto st = cache.stats();
+            REQUIRE(st.hits + st.misses == 80000);
+        }
+    }
+}
+
+TEST_CASE("TimerWheel: schedule, cancel and expire") {
+    dsa::timer::TimerWheel<int> wheel;
+    std::vector<std::pair<std::uint64_t, int>> fired;
+    auto record = [&](std::uint64_t, int payload) {
+        fired.emplace_back(wheel.time(), payload);
+    };
+
+    // delays on every wheel, including across wheel boundaries
+    std::vector<std::uint64_t> delays = {1, 5, 255, 256, 257, 1000, 65535, 65536, 65537, 300000, 1 << 20};
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        wheel.schedule(delays[i], static_cast<int>(i));
+    }
+    auto doomed = wheel.schedule(500, -1);
+    REQUIRE(wheel.size() == delays.size() + 1);
+    REQUIRE(wheel.cancel(doomed));
+    REQUIRE_FALSE(wheel.cancel(doomed));
+
+    REQUIRE(wheel.advance(1 << 20, record) == delays.size());
+    REQUIRE(wheel.empty());
+    REQUIRE(fired.size() == delays.size());
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        REQUIRE(fired[i].first == delays[i]);
+        REQUIRE(fired[i].second == static_cast<int>(i));
+    }
+
+    SECTION("Timers scheduled mid-way and from callbacks") {
+        fired.clear();
+        wheel.advance(100, record);
+        auto id = wheel.schedule(70000, 1);
+        wheel.advance(69999, record);
+        REQUIRE(fired.empty());
+        wheel.advance(1, [&](std::uint64_t fired_id, int payload) {
+            REQUIRE(fired_id == id);
+            REQUIRE_FALSE(wheel.cancel(fired_id));   // already fired
+            wheel.schedule(0, payload + 1);          // next tick
+        });
+        REQUIRE(wheel.advance(1, record) == 1);
+        REQUIRE(fired.back().second == 2);
+    }
+
+    SECTION("Cancelling frees the timer at once") {
+        auto first = wheel.schedule(1'000'000, 0);
+        REQUIRE(wheel.cancel(first));
+        for (int i = 0; i < 1000; ++i) {
+            auto id = wheel.schedule(1'000'000, i);
+            REQUIRE(static_cast<std::uint32_t>(id) == static_cast<std::uint32_t>(first));   // same handle
+            REQUIRE(id != first);
+            REQUIRE(wheel.cancel(id));
+        }
+        REQUIRE(wheel.empty());
+        fired.clear();
+        REQUIRE(wheel.advance(1'000'001, record) == 0);
+        REQUIRE(fired.empty());
+    }
+
+    SECTION("A throwing callback doesn't drop the rest of its tick") {
+        auto a = wheel.schedule(10, 1);
+        wheel.schedule(10, 2);
+        wheel.schedule(10, 3);
+        wheel.schedule(11, 4);
+        std::vector<int> seen;
+        REQUIRE_THROWS_AS(wheel.advance(20, [&](std::uint64_t, int payload) {
+            seen.push_back(payload);
+            if (payload == 1) {
+                throw std::runtime_error("callback failed");
+            }
+        }), std::runtime_error);
+        REQUIRE(seen == std::vector<int>{1, 2, 3});
+        REQUIRE(wheel.size() == 1);
+        REQUIRE_FALSE(wheel.cancel(a));
+        REQUIRE(wheel.advance(1, record) == 1);
+        REQUIRE(fired.back().second == 4);
+    }
+
+    SECTION("A callback can cancel a timer due the same tick") {
+        wheel.schedule(3, 1);
+        auto second = wheel.schedule(3, 2);
+        wheel.schedule(3, 3);
+        fired.clear();
+        REQUIRE(wheel.advance(3, [&](std::uint64_t, int payload) {
+            record(0, payload);
+            if (payload == 1) {
+                REQUIRE(wheel.cancel(second));
+            }
+        }) == 2);
+        REQUIRE(fired.size() == 2);
+        REQUIRE(fired[1].second == 3);
+        REQUIRE(wheel.empty());
+    }
+}
+
+namespace {
+// a timer payload whose move constructor throws for the value 2 while fail is set
+struct Touchy {
+    int value;
+    static inline bool fail = false;
+    explicit Touchy(int v) : value{v} {}
+    Touchy(Touchy&& other) : value{other.value} {
+        if (fail && value == 2) {
+            throw std::runtime_error("move failed");
+        }
+    }
+};
+}
+
+TEST_CASE("TimerWheel: a payload that throws on move keeps the rest of its tick") {
+    dsa::timer::TimerWheel<Touchy> wheel;
+    for (int i = 1; i <= 3; ++i) {
+        wheel.schedule(5, Touchy{i});
+    }
+    std::vector<int> seen;
+    auto record = [&](std::uint64_t, const Touchy& t) {
+        seen.push_back(t.value);
+    };
+    Touchy::fail = true;
+    REQUIRE_THROWS_AS(wheel.advance(5, record), std::runtime_error);
+    REQUIRE(seen == std::vector<int>{1});
+    REQUIRE(wheel.size() == 2);
+    Touchy::fail = false;
+    // the unfired timers went back to their slot, which comes round again
+    REQUIRE(wheel.advance(256, record) == 2);
+    REQUIRE(seen == std::vector<int>{1, 2, 3});
+    REQUIRE(wheel.empty());
+}
+
+TEST_CASE("RoundRobin: rotation and weighted dispatch") {
+    dsa::sched::RoundRobin<char> rr;
+    rr.add('a');
+    rr.add('b');
+    rr.add('c');
+    REQUIRE(rr.current() == 'a');
+
+    rr.advance();
+    REQUIRE(rr.current() == 'b');
+    rr.advance(4);                       // 4 mod 3 == 1
+    REQUIRE(rr.current() == 'c');
+
+    auto removed = rr.remove_current();
+    REQUIRE(removed.item == 'c');
+    REQUIRE(rr.current() == 'a');
+    REQUIRE(rr.size() == 2);
+    rr.reinsert(removed);                // back of the round: a b c
+    rr.advance(2);
+    REQUIRE(rr.current() == 'c');
+
+    SECTION("Dispatch shares follow the weights") {
+        dsa::sched::RoundRobin<char> drr(2);
+        drr.add('x', 1);
+        drr.add('y', 3);
+        int x = 0;
+        int y = 0;
+        for (int i = 0; i < 8000; ++i) {
+            (drr.dispatch() == 'x' ? x : y)++;
+        }
+        REQUIRE(x == 2000);
+        REQUIRE(y == 6000);
+
+        // requests costlier than one quantum accumulate credit over rounds
+        REQUIRE(drr.dispatch(7) == 'y');
+    }
+
+    SECTION("Empty scheduler") {
+        dsa::sched::RoundRobin<int> none;
+        REQUIRE_THROWS_AS(none.dispatch(), std::runtime_error);
+        REQUIRE_THROWS_AS(none.remove_current(), std::runtime_error);
+        REQUIRE_THROWS_AS(none.add(1, 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("CircularlyLinkedList: iterators") {
+    dsa::list::CircularlyLinkedList<int> ring;
+    REQUIRE(ring.begin() == ring.end());
+    for (int i = 1; i <= 5; ++i) {
+        ring.push_back(i);
+    }
+
+    std::vector<int> seen(ring.begin(), ring.end());
+    REQUIRE(seen == std::vector<int>{1, 2, 3, 4, 5});
+    REQUIRE(std::find(ring.begin(), ring.end(), 4) != ring.end());
+    REQUIRE(std::find(ring.begin(), ring.end(), 9) == ring.end());
+    REQUIRE(std::count_if(ring.begin(), ring.end(), [](int x) { return x % 2 == 1; }) == 3);
+    REQUIRE(dsa::list::parallel_reduce(ring, 0) == 15);
+    for (int& x : ring) {
+        x *= 10;
+    }
+    const auto& cring = ring;
+    REQUIRE(*std::max_element(cring.begin(), cring.end()) == 50);
+    REQUIRE(std::distance(ring.cbegin(), ring.cend()) == 5);
+    dsa::list::CircularlyLinkedList<int>::const_iterator third = std::next(ring.begin(), 2);
+    REQUIRE(*third == 30);
+    REQUIRE(third == std::next(ring.cbegin(), 2));
+    REQUIRE(std::next(third, 3) == ring.cend());
+
+    SECTION("insert_after and erase_after, including at the back") {
+        auto it = ring.insert_after(ring.begin(), 15);      // 10 15 20 30 40 50
+        REQUIRE(*it == 15);
+        auto last = ring.begin();
+        for (int i = 0; i < 5; ++i) {
+            ++last;
+        }
+        ring.insert_after(last, 60);                        // new back
+        REQUIRE(ring.back() == 60);
+        REQUIRE(ring.size() == 7);
+
+        auto next = ring.erase_after(last);                 // drops the back again
+        REQUIRE(next == ring.end());
+        REQUIRE(ring.back() == 50);
+        next = ring.erase_after(last);                      // wraps: drops the front
+        REQUIRE(next == ring.begin());
+        REQUIRE(ring.front() == 15);
+        std::size_t visited = 0;
+        for (; next != ring.end(); ++next) {               // iterating on stops after one lap
+            visited++;
+        }
+        REQUIRE(visited == ring.size());
+        REQUIRE(std::vector<int>(ring.begin(), ring.end()) == std::vector<int>{15, 20, 30, 40, 50});
+        REQUIRE_THROWS_AS(ring.insert_after(ring.end(), 1), std::runtime_error);
+
+        dsa::list::CircularlyLinkedList<int> one;
+        one.push_back(1);
+        REQUIRE_THROWS_AS(one.erase_after(one.begin()), std::runtime_error);
+    }
+
+    SECTION("A cursor wraps around") {
+        auto c = ring.ring_cursor();
+        for (int i = 0; i < 7; ++i) {
+            ++c;
+        }
+        REQUIRE(*c == 30);
+        REQUIRE(ring.front() == 10);
+        dsa::list::CircularlyLinkedList<int> none;
+        REQUIRE_THROWS_AS(none.ring_cursor(), std::runtime_error);
+    }
+}
+
+TEST_CASE("CircularlyLinkedList: rotate by k and rotate_to") {
+    dsa::list::CircularlyLinkedList<int> ring;
+    ring.rotate(3);                     // no-op on an empty ring
+    for (int i = 0; i < 5; ++i) {
+        ring.push_back(i);
+    }
+
+    ring.rotate(2);
+    REQUIRE(ring.front() == 2);
+    ring.rotate(-3);
+    REQUIRE(ring.front() == 4);
+    ring.rotate(11);                    // 11 mod 5 == 1
+    REQUIRE(ring.front() == 0);
+    ring.rotate(-10);
+    REQUIRE(ring.front() == 0);
+    REQUIRE(ring.back() == 4);
+
+    auto it = std::find(ring.begin(), ring.end(), 3);
+    ring.rotate_to(it);
+    REQUIRE(std::vector<int>(ring.begin(), ring.end()) == std::vector<int>{3, 4, 0, 1, 2});
+    REQUIRE_THROWS_AS(ring.rotate_to(ring.end()), std::runtime_error);
+}
+
+TEST_CASE("Lists: configurable size type") {
+    STATIC_REQUIRE(std::is_same_v<dsa::list::SinglyLinkedList<int>::size_type, std::size_t>);
+    STATIC_REQUIRE(std::is_same_v<dsa::list::DoublyLinkedList<int, std::uint32_t>::size_type, std::uint32_t>);
+    STATIC_REQUIRE(sizeof(dsa::list::CircularlyLinkedList<int, std::uint32_t>)
+                   <= sizeof(dsa::list::CircularlyLinkedList<int>));
+
+    dsa::list::SinglyLinkedList<int, std::uint32_t> slist;
+    dsa::list::DoublyLinkedList<int, std::uint32_t> dlist;
+    dsa::list::CircularlyLinkedList<int, std::uint32_t> clist, half_a, half_b;
+    for (int i = 0; i < 100; ++i) {
+        slist.insert_sorted(99 - i);
+        dlist.push_back(i);
+        clist.push_back(i);
+    }
+    REQUIRE(slist.at(42) == 42);
+    REQUIRE_THROWS_AS(slist.at(100), std::out_of_range);
+    clist.splitEven(half_a, half_b);
+    REQUIRE(half_a.size() == 50u);
+    REQUIRE(half_b.front() == 50);
+
+    dlist.enable_order_index();
+    auto it = dlist.nth(60);
+    REQUIRE(*dlist.advance(it, -25) == 35);
+    REQUIRE(dlist.distance(it, dlist.begin()) == -60);
+    REQUIRE_THROWS_AS(dlist.advance(it, -61), std::out_of_range);
+
+    SECTION("Loading more elements than the size type can count fails") {
+        dsa::list::DoublyLinkedList<int> big;
+        for (int i = 0; i < 300; ++i) {
+            big.push_back(i);
+        }
+        std::stringstream buffer;
+        big.save(buffer);
+        dsa::list::DoublyLinkedList<int, std::uint8_t> tiny;
+        tiny.push_back(7);
+        REQUIRE_THROWS_AS(tiny.load(buffer), std::runtime_error);
+        REQUIRE(tiny.size() == 1u);
+    }
+
+    SECTION("Growing past max_size() throws std::length_error") {
+        dsa::list::SinglyLinkedList<int, std::uint8_t> s8;
+        dsa::list::DoublyLinkedList<int, std::uint8_t> d8;
+        dsa::list::CircularlyLinkedList<int, std::uint8_t> c8;
+        dsa::list::XorLinkedList<int, std::uint8_t> x8;
+        dsa::list::UnrolledList<int, 64, std::uint8_t> u8;
+        for (int i = 0; i < 255; ++i) {
+            s8.push_back(2 * i);
+            d8.push_back(i);
+            c8.push_back(i);
+            x8.push_back(i);
+            u8.push_back(i);
+        }
+        REQUIRE(s8.size() == s8.max_size());
+        REQUIRE(s8.at(254) == 508);       // the index still works on a full list
+        d8.enable_order_index();
+        REQUIRE(*d8.nth(254) == 254);
+        REQUIRE_THROWS_AS(s8.push_back(0), std::length_error);
+        REQUIRE_THROWS_AS(s8.push_front(0), std::length_error);
+        REQUIRE_THROWS_AS(s8.insert_after(s8.begin(), 0), std::length_error);
+        REQUIRE_THROWS_AS(s8.insert_sorted(1), std::length_error);
+        REQUIRE_THROWS_AS(d8.push_front(0), std::length_error);
+        REQUIRE_THROWS_AS(d8.insert(d8.begin(), 0), std::length_error);
+        REQUIRE_THROWS_AS(c8.push_back(0), std::length_error);
+        REQUIRE_THROWS_AS(c8.insert_after(c8.begin(), 0), std::length_error);
+        REQUIRE_THROWS_AS(x8.push_front(0), std::length_error);
+        REQUIRE_THROWS_AS(u8.insert(u8.begin(), 0), std::length_error);
+        REQUIRE(s8.size() == 255u);
+        REQUIRE(d8.size() == 255u);
+        REQUIRE(c8.size() == 255u);
+        REQUIRE(x8.size() == 255u);
+        REQUIRE(u8.size() == 255u);
+
+        // moving nodes in from another list counts too, and leaves both alone
+        dsa::list::DoublyLinkedList<int, std::uint8_t> one;
+        one.push_back(-1);
+        REQUIRE_THROWS_AS(d8.concatenate(one), std::length_error);
+        REQUIRE_THROWS_AS(d8.splice(d8.begin(), one, one.begin()), std::length_error);
+        REQUIRE(one.size() == 1u);
+        std::vector<dsa::list::DoublyLinkedList<int, std::uint8_t>> runs(2);
+        runs[0] = d8;
+        runs[1].push_back(7);
+        REQUIRE_THROWS_AS(merge_k(std::span(runs)), std::length_error);
+        REQUIRE(runs[0].size() == 255u);
+
+        // a union only fails if the result itself is too big
+        dsa::list::SinglyLinkedList<int, std::uint8_t> evens;
+        for (int i = 0; i < 10; ++i) {
+            evens.push_back(2 * i);
+        }
+        REQUIRE(set_union(s8, evens).size() == 255u);
+        evens.push_back(1);
+        REQUIRE_THROWS_AS(set_union(s8, evens), std::length_error);
+        REQUIRE_THROWS_AS(s8.set_union(evens), std::length_error);
+        REQUIRE(evens.size() == 11u);
+    }
+}
+
+TEST_CASE("Lists: copy assignment reuses nodes") {
+    auto make = [](auto& list, int n) {
+        for (int i = 0; i < n; ++i) {
+            list.push_back(i * 3);
+        }
+    };
+    auto contents = [](const auto& list) {
+        std::vector<int> out;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            out.push_back(*it);
+        }
+        return out;
+    };
+
+    SECTION("SinglyLinkedList") {
+        dsa::list::SinglyLinkedList<int> small, large, target;
+        make(small, 3);
+        make(large, 8);
+        make(target, 5);
+        const int* first = &target.front();
+        target = large;
+        REQUIRE(&target.front() == first);
+        REQUIRE(contents(target) == contents(large));
+        REQUIRE(target.back() == 21);
+        target = small;
+        REQUIRE(&target.front() == first);
+        REQUIRE(contents(target) == contents(small));
+        target.push_back(100);
+        REQUIRE(target.size() == 4);
+        target = dsa::list::SinglyLinkedList<int>{};
+        REQUIRE(target.empty());
+        target = small;
+        REQUIRE(target.back() == 6);
+    }
+
+    SECTION("DoublyLinkedList, including the order index and a moved-from target") {
+        dsa::list::DoublyLinkedList<int> small, large, target;
+        make(small, 3);
+        make(large, 800);
+        make(target, 500);
+        target.enable_order_index();
+        const int* first = &target.front();
+        target = large;
+        REQUIRE(&target.front() == first);
+        REQUIRE(contents(target) == contents(large));
+        REQUIRE(*target.nth(700) == 2100);
+        target = small;
+        REQUIRE(contents(target) == contents(small));
+        REQUIRE(target.rank(--target.end()) == 2);
+
+        dsa::list::DoublyLinkedList<int> taken(std::move(target));
+        target = large;
+        REQUIRE(target.size() == 800);
+    }
+
+    SECTION("CircularlyLinkedList") {
+        dsa::list::CircularlyLinkedList<int> small, large, target, empty;
+        make(small, 3);
+        make(large, 8);
+        make(target, 5);
+        const int* first = &target.front();
+        target = large;
+        REQUIRE(&target.front() == first);
+        REQUIRE(contents(target) == contents(large));
+        target = small;
+        REQUIRE(contents(target) == contents(small));
+        REQUIRE(target.back() == 6);
+        target.rotate();
+        REQUIRE(target.front() == 3);
+        target = empty;
+        REQUIRE(target.empty());
+        target = large;
+        REQUIRE(contents(target) == contents(large));
+    }
+}
+
+TEST_CASE("XorLinkedList: both ends, iterators and concatenate") {
+    dsa::list::XorLinkedList<int> list;
+    REQUIRE(list.begin() == list.end());
+    for (int i = 1; i <= 5; ++i) {
+        list.push_back(i);
+    }
+    list.push_front(0);
+    REQUIRE(list.size() == 6);
+    REQUIRE(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2, 3, 4, 5});
+
+    // walk back from end()
+    std::vector<int> backwards;
+    for (auto it = list.end(); it != list.begin();) {
+        backwards.push_back(*--it);
+    }
+    REQUIRE(backwards == std::vector<int>{5, 4, 3, 2, 1, 0});
+
+    list.pop_front();
+    list.pop_back();
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back() == 4);
+
+    list.reverse();
+    REQUIRE(std::vector<int>(list.begin(), list.end()) == std::vector<int>{4, 3, 2, 1});
+    list.reverse();
+
+    dsa::list::XorLinkedList<int> more;
+    more.push_back(10);
+    more.push_back(11);
+    list.concatenate(more);
+    REQUIRE(more.empty());
+    REQUIRE(list.size() == 6);
+    auto it = std::find(list.begin(), list.end(), 10);
+    REQUIRE(*--it == 4);
+    REQUIRE(*++(++it) == 11);
+    REQUIRE(list.back() == 11);
+
+    dsa::list::XorLinkedList<int> copy(list);
+    copy.pop_front();
+    REQUIRE(copy.front() == 2);
+    copy = list;
+    REQUIRE(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>(list.begin(), list.end()));
+
+    while (!list.empty()) {
+        list.pop_back();
+    }
+    REQUIRE_THROWS_AS(list.front(), std::runtime_error);
+}
+
+TEST_CASE("Lists: node layouts") {
+    using dsa::list::layout::cache_aligned;
+    using dsa::list::layout::out_of_line;
+    using Text = std::string;
+
+    SECTION("SinglyLinkedList with out-of-line elements") {
+        dsa::list::SinglyLinkedList<Text, std::size_t, out_of_line> list;
+        for (int i = 0; i < 200; ++i) {
+            list.insert_sorted(std::to_string(1000 + (i * 37) % 200));
+        }
+        REQUIRE(list.at(0) == "1000");
+        REQUIRE(*list.lower_bound("1100") == "1100");
+        auto copy = list;
+        copy.pop_front();
+        list = copy;
+        REQUIRE(list.front() == "1001");
+        list.reverse();
+        REQUIRE(list.front() == "1199");
+    }
+
+    SECTION("DoublyLinkedList, both layouts") {
+        dsa::list::DoublyLinkedList<long, std::size_t, cache_aligned> aligned;
+        dsa::list::DoublyLinkedList<long, std::size_t, out_of_line> split;
+        for (long i = 0; i < 1000; ++i) {
+            aligned.push_back(i);
+            split.push_front(i);
+        }
+        std::stringstream buffer;
+        aligned.save(buffer);
+        split.load(buffer);
+        REQUIRE(split.size() == 1000);
+        REQUIRE(split.front() == 0);
+        REQUIRE(split.back() == 999);
+        split.enable_order_index();
+        REQUIRE(*split.nth(500) == 500);
+        REQUIRE(dsa::list::parallel_reduce(aligned, 0L) == 999L * 1000 / 2);
+    }
+
+    SECTION("CircularlyLinkedList with out-of-line elements") {
+        dsa::list::CircularlyLinkedList<Text, std::uint32_t, out_of_line> ring, a, b;
+        for (int i = 0; i < 6; ++i) {
+            ring.push_back(Text(40, static_cast<char>('a' + i)));
+        }
+        ring.rotate(-1);
+        REQUIRE(ring.front()[0] == 'f');
+        ring.splitEven(a, b);
+        REQUIRE(a.back()[0] == 'b');
+        ring = b;
+        REQUIRE(ring.size() == 3u);
+        REQUIRE(ring.front()[0] == 'c');
+    }
+}
+
+TEST_CASE("Lists: compact") {
+    // true when the elements sit at a fixed positive stride, i.e. the nodes are in list order in one block
+    auto contiguous = [](const auto& list) {
+        std::vector<const char*> at;
+        for (const auto& x : list) {
+            at.push_back(reinterpret_cast<const char*>(&x));
+        }
+        for (std::size_t i = 1; i < at.size(); ++i) {
+            if (at[i] - at[i - 1] != at[1] - at[0] || at[1] <= at[0]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto values = [](const auto& list) {
+        std::vector<std::remove_cvref_t<decltype(list.front())>> out;
+        for (const auto& x : list) {
+            out.push_back(x);
+        }
+        return out;
+    };
+
+    SECTION("SinglyLinkedList, full and incremental") {
+        dsa::list::SinglyLinkedList<int> list;
+        list.push_back(0);
+        std::vector<dsa::list::SinglyLinkedList<int>::iterator> placed{list.begin()};
+        for (int i = 1; i < 2000; ++i) {
+            placed.push_back(list.insert_after(placed[(i * 7919) % placed.size()], i));
+        }
+        std::vector<int> expected = values(list);
+        REQUIRE_FALSE(contiguous(list));
+
+        list.compact();
+        REQUIRE(values(list) == expected);
+        REQUIRE(contiguous(list));
+
+        list.reverse();
+        std::reverse(expected.begin(), expected.end());
+        int calls = 1;
+        while (!list.compact(300)) {
+            calls++;
+            if (calls == 3) {
+                list.push_back(5000);      // changes between steps are fine
+                expected.push_back(5000);
+            }
+        }
+        REQUIRE(calls == 7);
+        REQUIRE(values(list) == expected);
+        REQUIRE(list.at(1000) == expected[1000]);   // skip index rebuilt over the moved nodes
+
+        // erasing the node a pass stopped at ends the pass
+        REQUIRE_FALSE(list.compact(1));
+        list.pop_front();
+        REQUIRE_FALSE(list.compact(10));
+        REQUIRE(list.size() == 2000);
+    }
+
+    SECTION("DoublyLinkedList with an order index and out-of-line strings") {
+        using Strings = dsa::list::DoublyLinkedList<std::string, std::size_t, dsa::list::layout::out_of_line>;
+        Strings list;
+        list.enable_order_index();
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(std::to_string(i));
+        }
+        const std::string* element = &*list.nth(10);
+        while (!list.compact(64)) {
+            list.splice(list.begin(), list, --list.end());   // rotate the back to the front
+        }
+        REQUIRE(&*list.nth(10 + 15) == element);     // elements themselves don't move
+        REQUIRE(list.size() == 1000);
+
+        // moving the node a pass stopped at within the list doesn't end the pass
+        REQUIRE(list.compact(1000));
+        REQUIRE_FALSE(list.compact(3));
+        list.splice(list.end(), list, std::next(list.begin(), 2));
+        REQUIRE_FALSE(list.compact(1));
+        while (!list.compact(100)) {
+        }
+        list.splice(std::next(list.begin(), 2), list, --list.end());   // put it back
+        REQUIRE(list.size() == 1000);
+        REQUIRE(list.front() == "985");
+        REQUIRE(*list.nth(999) == "984");
+
+        Strings other;
+        other.push_back("x");
+        REQUIRE_FALSE(list.compact(5));
+        other.concatenate(list);                    // list's pass ends with its nodes gone
+        REQUIRE(list.compact(5));
+        other.compact();
+        REQUIRE(other.size() == 1001);
+        auto zero = other.begin();
+        while (*zero != "0") {
+            ++zero;
+        }
+        REQUIRE(other.rank(zero) == 16);
+    }
+
+    SECTION("repeated budgeted passes free the slabs they empty") {
+        auto churn = [](auto& list) {
+            for (int i = 0; i < 500; ++i) {
+                list.push_back(i);
+            }
+            for (int pass = 0; pass < 20; ++pass) {
+                int steps = 0;
+                while (!list.compact(64)) {
+                    if (++steps % 3 == 0) {
+                        list.pop_front();            // churn between steps
+                        list.push_back(pass);
+                    }
+                }
+                REQUIRE(list.size() == 500);
+                REQUIRE(list.slab_count() <= 2);
+                REQUIRE(list.slab_capacity() <= 2 * list.size());
+            }
+        };
+        dsa::list::SinglyLinkedList<int> slist;
+        churn(slist);
+        dsa::list::DoublyLinkedList<int> dlist;
+        churn(dlist);
+    }
+}
+
+TEMPLATE_TEST_CASE("UnrolledList: edits and SIMD kernels", "", std::int32_t, std::int64_t, float, std::int16_t) {
+    using T = TestType;
+    dsa::list::UnrolledList<T, 16> list;
+    std::vector<T> model;
+    REQUIRE_THROWS_AS(list.min(), std::runtime_error);
+    REQUIRE(list.sum() == 0);
+
+    // a mix of pushes and middle inserts and erases, checked against a vector
+    std::uint32_t state = 12345;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    };
+    for (int step = 0; step < 3000; ++step) {
+        std::uint32_t r = next();
+        T value = static_cast<T>(static_cast<int>(r % 2001) - 1000);
+        if (model.empty() || r % 5 < 2) {
+            list.push_back(value);
+            model.push_back(value);
+        } else if (r % 5 == 2) {
+            std::size_t at = next() % (model.size() + 1);
+            auto it = list.begin();
+            for (std::size_t i = 0; i < at; ++i) {
+                ++it;
+            }
+            REQUIRE(*list.insert(it, value) == value);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(at), value);
+        } else if (r % 5 == 3) {
+            std::size_t at = next() % model.size();
+            auto it = list.begin();
+            for (std::size_t i = 0; i < at; ++i) {
+                ++it;
+            }
+            auto after = list.erase(it);
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(at));
+            REQUIRE((at == model.size() ? after == list.end() : *after == model[at]));
+        } else {
+            list.push_front(value);
+            model.insert(model.begin(), value);
+        }
+    }
+    REQUIRE(list.size() == model.size());
+    REQUIRE(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+    REQUIRE(std::equal(model.rbegin(), model.rend(), std::make_reverse_iterator(list.end())));
+
+    REQUIRE(list.min() == *std::min_element(model.begin(), model.end()));
+    REQUIRE(list.max() == *std::max_element(model.begin(), model.end()));
+    double expected_sum = 0;
+    for (T x : model) {
+        expected_sum += static_cast<double>(x);
+    }
+    REQUIRE(static_cast<double>(list.sum()) == Approx(expected_sum));
+    for (T probe : {model[model.size() / 2], model.back(), static_cast<T>(5000)}) {
+        auto found = list.find(probe);
+        auto expected = std::find(model.begin(), model.end(), probe);
+        REQUIRE((found == list.end()) == (expected == model.end()));
+        if (expected != model.end()) {
+            REQUIRE(std::distance(list.begin(), found) == std::distance(model.begin(), expected));
+        }
+        REQUIRE(list.count(probe) == static_cast<std::size_t>(std::count(model.begin(), model.end(), probe)));
+        REQUIRE(list.contains(probe) == (expected != model.end()));
+    }
+
+    auto copy = list;
+    while (!list.empty()) {
+        list.pop_front();
+    }
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(copy.size() == model.size());
+    REQUIRE(copy.back() == model.back());
+}
+
+TEST_CASE("Lists: remove_if, remove and unique") {
+    auto values = [](const auto& list) {
+        std::vector<int> out;
+        for (int x : list) {
+            out.push_back(x);
+        }
+        return out;
+    };
+
+    SECTION("SinglyLinkedList") {
+        dsa::list::SinglyLinkedList<int> list;
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(i % 10);
+        }
+        list.compact();                       // nodes in a slab go back to the pool's free list
+        REQUIRE(list.at(500) == 0);           // builds the skip index
+        REQUIRE(list.remove_if([](int x) { return x % 2 == 1; }) == 500);
+        REQUIRE(list.size() == 500);
+        REQUIRE(list.at(499) == 8);
+        REQUIRE(list.back() == 8);
+        REQUIRE(list.remove(0) == 100);
+        REQUIRE(list.remove(7) == 0);
+        list.push_back(9);                    // tail was updated
+        REQUIRE(list.back() == 9);
+
+        dsa::list::SinglyLinkedList<int> runs;
+        for (int x : {1, 1, 2, 2, 2, 3, 1, 1, 4, 4}) {
+            runs.push_back(x);
+        }
+        REQUIRE(runs.unique() == 5);
+        REQUIRE(values(runs) == std::vector<int>{1, 2, 3, 1, 4});
+        REQUIRE(runs.back() == 4);
+        REQUIRE(runs.unique([](int kept, int x) { return x < kept + 2; }) == 3);   // compared with the kept element
+        REQUIRE(values(runs) == std::vector<int>{1, 3});
+        REQUIRE(runs.remove_if([](int) { return true; }) == 2);
+        REQUIRE(runs.empty());
+        runs.push_back(5);
+        REQUIRE(runs.front() == 5);
+        REQUIRE(runs.back() == 5);
+
+        // a throwing predicate leaves the list valid, with earlier matches removed
+        dsa::list::SinglyLinkedList<int> partial;
+        for (int i = 0; i < 10; ++i) {
+            partial.push_back(i);
+        }
+        REQUIRE_THROWS(partial.remove_if([](int x) {
+            if (x == 6) {
+                throw std::runtime_error("stop");
+            }
+            return x % 2 == 0;
+        }));
+        REQUIRE(values(partial) == std::vector<int>{1, 3, 5, 6, 7, 8, 9});
+        REQUIRE(partial.size() == 7);
+        REQUIRE(partial.back() == 9);
+    }
+
+    SECTION("DoublyLinkedList") {
+        dsa::list::DoublyLinkedList<int> list;
+        list.enable_order_index();
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(i / 3);
+        }
+        REQUIRE(list.unique() == 666);
+        REQUIRE(list.size() == 334);
+        REQUIRE(*list.nth(200) == 200);       // order index rebuilt
+        REQUIRE(list.remove_if([](int x) { return x < 300; }) == 300);
+        REQUIRE(list.front() == 300);
+        REQUIRE(list.back() == 333);
+        REQUIRE(*--list.end() == 333);
+        REQUIRE(list.rank(list.begin()) == 0);
+        REQUIRE(list.remove(333) == 1);
+        REQUIRE(list.back() == 332);
+
+        dsa::list::DoublyLinkedList<int> partial;
+        for (int i = 0; i < 6; ++i) {
+            partial.push_back(i % 2);
+        }
+        int calls = 0;
+        REQUIRE_THROWS(partial.unique([&calls](int, int) {
+            if (++calls == 4) {
+                throw std::runtime_error("stop");
+            }
+            return true;
+        }));
+        REQUIRE(values(partial) == std::vector<int>{0, 0, 1});
+        REQUIRE(partial.size() == 3);
+        std::vector<int> backwards;
+        for (auto it = partial.end(); it != partial.begin();) {
+            backwards.push_back(*--it);
+        }
+        REQUIRE(backwards == std::vector<int>{1, 0, 0});
+    }
+}
+
+TEST_CASE("Lists: reverse, range reverse and reversed view") {
+    auto values = [](const auto& list) {
+        std::vector<int> out;
+        for (int x : list) {
+            out.push_back(x);
+        }
+        return out;
+    };
+
+    SECTION("DoublyLinkedList") {
+        dsa::list::DoublyLinkedList<int> list;
+        list.enable_order_index();
+        for (int i = 0; i < 6; ++i) {
+            list.push_back(i);
+        }
+        auto two = list.begin();
+        ++two;
+        ++two;
+        list.reverse();
+        REQUIRE(values(list) == std::vector<int>{5, 4, 3, 2, 1, 0});
+        REQUIRE(*two == 2);                    // iterators follow their element
+        REQUIRE(*++two == 1);
+        REQUIRE(*--list.end() == 0);
+        REQUIRE(*list.nth(1) == 4);            // order index rebuilt
+        REQUIRE(list.rank(two) == 4);
+
+        // [4, 3, 2] -> [2, 3, 4]
+        auto first = ++list.begin();
+        auto last = first;
+        for (int i = 0; i < 3; ++i) {
+            ++last;
+        }
+        list.reverse(first, last);
+        REQUIRE(values(list) == std::vector<int>{5, 2, 3, 4, 1, 0});
+        std::vector<int> backwards;
+        for (auto it = list.end(); it != list.begin();) {
+            backwards.push_back(*--it);
+        }
+        REQUIRE(backwards == std::vector<int>{0, 1, 4, 3, 2, 5});
+        list.reverse(list.begin(), list.begin());   // empty and single-element ranges
+        list.reverse(list.begin(), ++list.begin());
+        REQUIRE(list.front() == 5);
+
+        auto view = list.reversed();
+        REQUIRE(values(view) == std::vector<int>{0, 1, 4, 3, 2, 5});
+        REQUIRE(view.front() == 0);
+        REQUIRE(view.back() == 5);
+        *view.begin() = 10;                    // writes through to the list
+        REQUIRE(list.back() == 10);
+        list.push_front(-1);                   // the view follows the list
+        REQUIRE(view.back() == -1);
+        REQUIRE(view.size() == 7);
+
+        const auto& cref = list;
+        REQUIRE(values(cref.reversed()) == std::vector<int>{10, 1, 4, 3, 2, 5, -1});
+        auto rit = cref.reversed().end();
+        REQUIRE(*--rit == -1);
+    }
+
+    SECTION("SinglyLinkedList") {
+        dsa::list::SinglyLinkedList<int> list;
+        for (int i = 0; i < 6; ++i) {
+            list.push_back(i);
+        }
+        auto one = ++list.begin();
+        auto four = one;
+        for (int i = 0; i < 3; ++i) {
+            ++four;
+        }
+        list.reverse(one, four);               // [1, 2, 3] in the middle
+        REQUIRE(values(list) == std::vector<int>{0, 3, 2, 1, 4, 5});
+        REQUIRE(*one == 1);
+        REQUIRE(*++one == 4);
+
+        REQUIRE(list.at(2) == 2);              // builds the skip index
+        list.reverse(list.begin(), list.end());
+        REQUIRE(values(list) == std::vector<int>{5, 4, 1, 2, 3, 0});
+        REQUIRE(list.front() == 5);
+        REQUIRE(list.back() == 0);
+        REQUIRE(list.at(2) == 1);
+        list.push_back(6);                     // tail was moved
+        REQUIRE(values(list) == std::vector<int>{5, 4, 1, 2, 3, 0, 6});
+
+        auto three = list.begin();
+        for (int i = 0; i < 4; ++i) {
+            ++three;
+        }
+        list.reverse(three, list.end());       // suffix
+        REQUIRE(values(list) == std::vector<int>{5, 4, 1, 2, 6, 0, 3});
+        REQUIRE(list.back() == 3);
+        list.reverse(list.begin(), list.begin());
+        REQUIRE(list.size() == 7);
+    }
+}
+
+static_assert(std::forward_iterator<dsa::list::SinglyLinkedList<int>::iterator>);
+static_assert(std::forward_iterator<dsa::list::SinglyLinkedList<int>::const_iterator>);
+static_assert(std::ranges::forward_range<dsa::list::SinglyLinkedList<int>>);
+static_assert(std::bidirectional_iterator<dsa::list::DoublyLinkedList<int>::iterator>);
+static_assert(std::bidirectional_iterator<dsa::list::DoublyLinkedList<int>::const_iterator>);
+static_assert(std::ranges::bidirectional_range<const dsa::list::DoublyLinkedList<int>>);
+static_assert(std::ranges::bidirectional_range<dsa::list::DoublyLinkedList<int>::reversed_view>);
+static_assert(std::ranges::common_range<dsa::list::DoublyLinkedList<std::string>>);
+
+TEST_CASE("Lists: standard iterator algorithms and ranges") {
+    dsa::list::DoublyLinkedList<int> dlist;
+    dsa::list::SinglyLinkedList<int> slist;
+    for (int i = 0; i < 10; ++i) {
+        dlist.push_back(i);
+        slist.push_back(i * i);
+    }
+
+    REQUIRE(std::vector<int>(dlist.rbegin(), dlist.rend()) == std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0});
+    REQUIRE(*std::prev(dlist.end(), 3) == 7);
+    REQUIRE(*std::next(dlist.cbegin(), 2) == 2);
+    REQUIRE(std::distance(dlist.begin(), dlist.end()) == 10);
+    REQUIRE(std::accumulate(dlist.crbegin(), dlist.crend(), 0) == 45);
+    REQUIRE(*std::ranges::find(dlist, 4) == 4);
+    REQUIRE(std::ranges::count_if(dlist, [](int x) { return x % 3 == 0; }) == 4);
+    auto backwards = dlist.reversed();
+    REQUIRE(*std::ranges::max_element(backwards) == 9);
+    std::ranges::reverse(dlist);                 // swaps elements through the iterators
+    REQUIRE(dlist.front() == 9);
+    REQUIRE(std::ranges::equal(dlist | std::views::reverse | std::views::take(3), std::vector<int>{0, 1, 2}));
+
+    auto it = dlist.rbegin();
+    *it = 100;
+    REQUIRE(dlist.back() == 100);
+    dsa::list::DoublyLinkedList<int>::const_iterator converted = dlist.begin();
+    REQUIRE(converted == dlist.cbegin());
+
+    REQUIRE(*std::ranges::lower_bound(slist, 50) == 64);
+    REQUIRE(std::ranges::distance(slist) == 10);
+    REQUIRE(std::ranges::is_sorted(slist));
+    auto evens = slist | std::views::filter([](int x) { return x % 2 == 0; });
+    REQUIRE(std::ranges::equal(evens, std::vector<int>{0, 4, 16, 36, 64}));
+    dsa::list::SinglyLinkedList<int>::const_iterator sconverted = slist.begin();
+    REQUIRE(sconverted == slist.cbegin());
+    REQUIRE(std::ranges::find(std::as_const(slist), 81) != slist.cend());
+}
+
+TEST_CASE("SinglyLinkedList: set operations on sorted lists") {
+    using List = dsa::list::SinglyLinkedList<int>;
+    auto values = [](const List& list) {
+        return std::vector<int>(list.begin(), list.end());
+    };
+    auto make = [](const std::vector<int>& v) {
+        List list;
+        for (int x : v) {
+            list.push_back(x);
+        }
+        return list;
+    };
+    std::uint32_t state = 7;
+    auto sorted_sample = [&state](std::size_t n, int range) {
+        std::vector<int> v;
+        for (std::size_t i = 0; i < n; ++i) {
+            state = state * 1664525u + 1013904223u;
+            v.push_back(static_cast<int>((state >> 8) % static_cast<std::uint32_t>(range)));
+        }
+        std::sort(v.begin(), v.end());
+        return v;
+    };
+
+    // balanced sizes walk both lists; skewed ones look the short side up in the long one
+    const std::pair<std::size_t, std::size_t> shapes[] = {{0, 0}, {0, 5}, {40, 50}, {3, 2000}, {2000, 3}, {300, 300}, {1, 5000}, {20, 5000}};
+    for (auto [na, nb] : shapes) {
+        std::vector<int> va = sorted_sample(na, 100);
+        std::vector<int> vb = sorted_sample(nb, 100);
+        std::vector<int> expected_union, expected_inter, expected_diff;
+        std::set_union(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected_union));
+        std::set_intersection(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected_inter));
+        std::set_difference(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected_diff));
+
+        List a = make(va);
+        List b = make(vb);
+        REQUIRE(values(set_union(a, b)) == expected_union);
+        REQUIRE(values(set_intersection(a, b)) == expected_inter);
+        REQUIRE(values(set_difference(a, b)) == expected_diff);
+        REQUIRE(values(a) == va);
+        REQUIRE(values(b) == vb);
+
+        List inter = make(va);
+        inter.set_intersection(b);
+        REQUIRE(values(inter) == expected_inter);
+        REQUIRE(inter.size() == expected_inter.size());
+        List diff = make(va);
+        diff.set_difference(b);
+        REQUIRE(values(diff) == expected_diff);
+
+        // a longer side that already has a skip index is looked up through it
+        List indexed = make(vb);
+        if (!vb.empty()) {
+            REQUIRE(indexed.at(vb.size() / 2) == vb[vb.size() / 2]);
+        }
+        REQUIRE(values(set_intersection(a, indexed)) == expected_inter);
+        REQUIRE(values(set_difference(a, indexed)) == expected_diff);
+        List diff_indexed = make(va);
+        diff_indexed.set_difference(indexed);
+        REQUIRE(values(diff_indexed) == expected_diff);
+
+        List uni = make(va);
+        if (!va.empty()) {
+            REQUIRE(uni.at(0) == va[0]);   // a live skip index lets the union gallop too
+        }
+        List consumed = make(vb);
+        uni.set_union(consumed);
+        REQUIRE(values(uni) == expected_union);
+        REQUIRE(uni.size() == expected_union.size());
+        REQUIRE(consumed.empty());
+        if (!expected_union.empty()) {
+            REQUIRE(uni.back() == expected_union.back());
+            REQUIRE(uni.at(uni.size() - 1) == expected_union.back());
+        }
+        uni.push_back(1000);               // tail is right after the merge
+        REQUIRE(uni.back() == 1000);
+    }
+
+    List a = make({1, 2, 3});
+    a.set_union(a);
+    a.set_intersection(a);
+    REQUIRE(values(a) == std::vector<int>{1, 2, 3});
+    a.set_difference(a);
+    REQUIRE(a.empty());
+}
+
+TEST_CASE("DoublyLinkedList: merge_k") {
+    using List = dsa::list::DoublyLinkedList<std::pair<int, int>>;   // (key, source list)
+    auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    std::uint32_t state = 99;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    };
+
+    for (unsigned threads : {1u, 4u}) {
+        for (std::size_t k : {0u, 1u, 2u, 7u, 64u}) {
+            std::vector<List> lists(k);
+            std::vector<std::pair<int, int>> expected;
+            for (std::size_t i = 0; i < k; ++i) {
+                std::vector<int> keys(next() % (i == 3 ? 1 : 400));   // one list stays empty
+                for (int& key : keys) {
+                    key = static_cast<int>(next() % 1000);
+                }
+                std::sort(keys.begin(), keys.end());
+                for (int key : keys) {
+                    lists[i].push_back({key, static_cast<int>(i)});
+                    expected.push_back({key, static_cast<int>(i)});
+                }
+            }
+            if (k > 5) {
+                List moved = std::move(lists[5]);   // moved-from lists count as empty
+                expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                              [](const auto& e) { return e.second == 5; }),
+                               expected.end());
+            }
+            std::stable_sort(expected.begin(), expected.end(), by_key);   // ties keep list order
+
+            List merged = merge_k(lists, by_key, threads);
+            REQUIRE(merged.size() == expected.size());
+            REQUIRE(std::equal(merged.begin(), merged.end(), expected.begin(), expected.end()));
+            REQUIRE(std::equal(merged.rbegin(), merged.rend(), expected.rbegin(), expected.rend()));
+            for (std::size_t i = 0; i < k; ++i) {
+                if (i != 5) {
+                    REQUIRE(lists[i].empty());
+                    lists[i].push_back({1, 1});   // still usable
+                    REQUIRE(lists[i].size() == 1);
+                }
+            }
+        }
+    }
+
+    SECTION("large merge on several threads") {
+        std::vector<dsa::list::DoublyLinkedList<int>> lists(16);
+        for (int i = 0; i < 200000; ++i) {
+            lists[static_cast<std::size_t>(i % 16)].push_back(i);
+        }
+        lists[3].enable_order_index();
+        auto merged = merge_k(lists, std::less<>{}, 4);
+        REQUIRE(merged.size() == 200000);
+        int expect = 0;
+        for (int x : merged) {
+            REQUIRE(x == expect++);
+        }
+        REQUIRE(lists[3].empty());
+        lists[3].push_back(1);
+        REQUIRE(*lists[3].nth(0) == 1);
+    }
+
+    SECTION("a throwing comparison loses no element") {
+        for (unsigned threads : {1u, 4u}) {
+            std::vector<dsa::list::DoublyLinkedList<int>> lists(8);
+            for (int i = 0; i < 80000; ++i) {
+                lists[static_cast<std::size_t>(i % 8)].push_back(i);
+            }
+            std::atomic<int> calls{0};
+            auto fragile = [&calls](int a, int b) {
+                if (++calls == 150000) {
+                    throw std::runtime_error("comparison failed");
+                }
+                return a < b;
+            };
+            REQUIRE_THROWS(merge_k(lists, fragile, threads));
+            REQUIRE(lists[0].size() == 80000);
+            std::vector<int> all(lists[0].begin(), lists[0].end());
+            std::sort(all.begin(), all.end());
+            for (int i = 0; i < 80000; ++i) {
+                REQUIRE(all[static_cast<std::size_t>(i)] == i);
+            }
+            std::size_t backwards = 0;
+            for (auto it = lists[0].rbegin(); it != lists[0].rend(); ++it) {
+                backwards++;
+            }
+            REQUIRE(backwards == 80000);
+        }
+    }
+}
+
+TEST_CASE("AdjacencyList: edges, traversals and CSR form") {
+    using Graph = dsa::graph::AdjacencyList<>;
+    auto collect = [](auto&& range) {
+        std::vector<std::uint32_t> out;
+        for (std::uint32_t v : range) {
+            out.push_back(v);
+        }
+        return out;
+    };
+
+    //  0 -> 1 -> 3 -> 5
+    //  0 -> 2 -> 3,  2 -> 4,  5 -> 0,  6 isolated
+    Graph g(7);
+    const std::vector<Graph::edge_type> edges{{0, 1}, {0, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 5}, {5, 0}};
+    g.load_edges(edges);
+    REQUIRE(g.vertex_count() == 7);
+    REQUIRE(g.edge_count() == 7);
+    REQUIRE(collect(g.neighbors(0)) == std::vector<std::uint32_t>{1, 2});   // array order
+    REQUIRE(g.out_degree(2) == 2);
+    REQUIRE(g.out_degree(6) == 0);
+    REQUIRE(collect(g.bfs(0)) == std::vector<std::uint32_t>{0, 1, 2, 3, 4, 5});
+    REQUIRE(collect(g.dfs(0)) == std::vector<std::uint32_t>{0, 1, 3, 5, 2, 4});
+    REQUIRE(collect(g.bfs(6)) == std::vector<std::uint32_t>{6});
+    REQUIRE(collect(g.dfs(4)) == std::vector<std::uint32_t>{4});
+
+    g.add_edge(0, 4);                                                      // goes first
+    REQUIRE(collect(g.neighbors(0)) == std::vector<std::uint32_t>{4, 1, 2});
+    REQUIRE(collect(g.dfs(0)) == std::vector<std::uint32_t>{0, 4, 1, 3, 5, 2});
+
+    g.compact();
+    REQUIRE(g.is_compacted());
+    REQUIRE(collect(g.neighbors(0)) == std::vector<std::uint32_t>{4, 1, 2});
+    REQUIRE(g.out_degree(0) == 3);
+    REQUIRE(collect(g.bfs(0)) == std::vector<std::uint32_t>{0, 4, 1, 2, 3, 5});
+    REQUIRE(collect(g.dfs(0)) == std::vector<std::uint32_t>{0, 4, 1, 3, 5, 2});
+
+    std::uint32_t v = g.add_vertex();                                      // back to lists
+    REQUIRE_FALSE(g.is_compacted());
+    g.add_edge(6, v);
+    REQUIRE(collect(g.neighbors(0)) == std::vector<std::uint32_t>{4, 1, 2});
+    REQUIRE(collect(g.bfs(6)) == std::vector<std::uint32_t>{6, 7});
+    REQUIRE(g.edge_count() == 9);
+
+    REQUIRE_THROWS_AS(g.add_edge(0, 8), std::out_of_range);
+    const std::vector<Graph::edge_type> bad{{0, 1}, {9, 0}};
+    REQUIRE_THROWS_AS(g.load_edges(bad), std::out_of_range);
+    REQUIRE(g.edge_count() == 9);                                          // nothing added
+    REQUIRE_THROWS_AS(g.bfs(8), std::out_of_range);
+
+    Graph moved = std::move(g);
+    REQUIRE(moved.edge_count() == 9);
+    REQUIRE(g.vertex_count() == 0);
+    g.add_vertex();
+    g.add_edge(0, 0);
+    REQUIRE(collect(g.bfs(0)) == std::vector<std::uint32_t>{0});
+    REQUIRE(collect(moved.neighbors(6)) == std::vector<std::uint32_t>{7});
+
+    SECTION("random graph: same traversals in both forms") {
+        const std::uint32_t n = 2000;
+        Graph r(n);
+        std::uint32_t state = 3;
+        std::vector<Graph::edge_type> batch;
+        for (int i = 0; i < 6000; ++i) {
+            state = state * 1664525u + 1013904223u;
+            std::uint32_t from = (state >> 8) % n;
+            state = state * 1664525u + 1013904223u;
+            std::uint32_t to = (state >> 8) % n;
+            if (i % 3 == 0) {
+                r.add_edge(from, to);
+            } else {
+                batch.push_back({from, to});
+            }
+        }
+        r.load_edges(batch);
+        REQUIRE(r.edge_count() == 6000);
+        auto bfs = collect(r.bfs(0));
+        auto dfs = collect(r.dfs(0));
+        REQUIRE(bfs.size() == dfs.size());
+        REQUIRE(bfs.size() > n / 2);
+        std::vector<std::uint32_t> sorted_bfs = bfs;
+        std::sort(sorted_bfs.begin(), sorted_bfs.end());
+        REQUIRE(std::adjacent_find(sorted_bfs.begin(), sorted_bfs.end()) == sorted_bfs.end());
+        r.compact();
+        REQUIRE(collect(r.bfs(0)) == bfs);
+        REQUIRE(collect(r.dfs(0)) == dfs);
+        std::size_t total = 0;
+        for (std::uint32_t u = 0; u < n; ++u) {
+            total += r.out_degree(u);
+        }
+        REQUIRE(total == 6000);
+    }
+}